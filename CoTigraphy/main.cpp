@@ -1,5 +1,5 @@
 ﻿// \file main.cpp
-// \last_updated 2025-06-14
+// \last_updated 2026-10-16
 // \author Oh Sungsik <ohsungsik@outlook.com>
 // \copyright (C) 2025. Oh Sungsik. All rights reserved.
 
@@ -8,15 +8,13 @@
 
 int wmain()
 {
-    std::wstring githubToken;
-    std::wstring userName;
-    std::wstring outputPath;
+    CoTigraphy::RunOptions runOptions;
 
-    CoTigraphy::Error error = CoTigraphy::Initialize(githubToken, userName, outputPath);
+    CoTigraphy::Error error = CoTigraphy::Initialize(runOptions);
     if (error.IsFailed())
         return static_cast<int>(error.GetErrorCode());
 
-    error = CoTigraphy::Run(githubToken, userName, outputPath);
+    error = CoTigraphy::Run(runOptions);
     if (error.IsFailed())
         return static_cast<int>(error.GetErrorCode());
 
@@ -0,0 +1,181 @@
+﻿// \file BatchRenderer.cpp
+// \last_updated 2026-10-16
+// \author Oh Sungsik <ohsungsik@outlook.com>
+// \copyright (C) 2025. Oh Sungsik. All rights reserved.
+
+#include "pch.hpp"
+#include "BatchRenderer.hpp"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+
+#include "Renderer.hpp"
+
+namespace CoTigraphy
+{
+    BatchRenderer::BatchRenderer() noexcept
+    = default;
+
+    BatchRenderer::~BatchRenderer()
+    = default;
+
+    Error BatchRenderer::LoadJobs(_In_ const std::wstring& usersFilePath)
+    {
+        PRECONDITION(usersFilePath.empty() == false);
+
+        std::ifstream file(std::filesystem::path(usersFilePath), std::ios::binary);
+        if (file.is_open() == false)
+            return MAKE_ERROR(eErrorCode::FileIOFailure);
+
+        const std::string utf8((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        if (file.bad())
+            return MAKE_ERROR(eErrorCode::FileIOFailure);
+
+        std::wstring text;
+        if (utf8.empty() == false)
+        {
+            ASSERT(utf8.size() <= static_cast<size_t>(std::numeric_limits<int>::max()));
+            const int utf8Length = static_cast<int>(utf8.size());
+
+            const int sizeRequired = MultiByteToWideChar(CP_UTF8, 0, utf8.data(), utf8Length, nullptr, 0);
+            if (sizeRequired <= 0)
+                return MAKE_ERROR(eErrorCode::InvalidUsersFile);
+
+            text.resize(static_cast<size_t>(sizeRequired));
+            MultiByteToWideChar(CP_UTF8, 0, utf8.data(), utf8Length, text.data(), sizeRequired);
+        }
+
+        RETURN_IF_FAILED(ParseJobs(text, mJobs));
+
+        if (mJobs.empty())
+            return MAKE_ERROR(eErrorCode::InvalidUsersFile);
+
+        return MAKE_ERROR(eErrorCode::Succeeded);
+    }
+
+    Error BatchRenderer::Run(_In_ const std::wstring& githubToken, _In_ const RenderOptions& renderOptions,
+                             _In_ const size_t workerCount)
+    {
+        PRECONDITION(mJobs.empty() == false);
+
+        size_t threadCount = workerCount;
+        if (threadCount == 0)
+            threadCount = std::max<size_t>(1, std::thread::hardware_concurrency());
+        threadCount = std::min(threadCount, mJobs.size());
+
+        mNextJobIndex = 0;
+        mSucceededCount = 0;
+        mFailures.clear();
+
+        const auto startTime = std::chrono::steady_clock::now();
+
+        std::vector<std::thread> workers;
+        workers.reserve(threadCount);
+        for (size_t i = 0; i < threadCount; ++i)
+            workers.emplace_back(&BatchRenderer::WorkerMain, this, std::cref(githubToken), std::cref(renderOptions));
+
+        for (std::thread& worker : workers)
+            worker.join();
+
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - startTime;
+        const double seconds = elapsed.count();
+        const double rendersPerSecond = seconds > 0.0 ? static_cast<double>(mSucceededCount) / seconds : 0.0;
+
+        std::wcout << L"Rendered " << mSucceededCount << L"/" << mJobs.size() << L" users with "
+            << threadCount << L" workers in " << std::fixed << std::setprecision(2) << seconds << L" s ("
+            << rendersPerSecond << L" renders/sec)\n";
+
+        if (mFailures.empty() == false)
+        {
+            // 작업 순서상 가장 먼저 실패한 에러를 반환
+            const auto& firstFailure = *std::min_element(mFailures.begin(), mFailures.end(),
+                                                         [](const auto& lhs, const auto& rhs)
+                                                         {
+                                                             return lhs.first < rhs.first;
+                                                         });
+            return firstFailure.second;
+        }
+
+        return MAKE_ERROR(eErrorCode::Succeeded);
+    }
+
+    Error BatchRenderer::ParseJobs(_In_ const std::wstring& text, _Out_ std::vector<RenderJob>& outJobs)
+    {
+        outJobs.clear();
+
+        constexpr const wchar_t* const whitespaces = L" \t\r";
+
+        size_t lineBegin = 0;
+        while (lineBegin < text.size())
+        {
+            size_t lineEnd = text.find(L'\n', lineBegin);
+            if (lineEnd == std::wstring::npos)
+                lineEnd = text.size();
+
+            std::wstring_view line(text.data() + lineBegin, lineEnd - lineBegin);
+            lineBegin = lineEnd + 1;
+
+            // UTF-8 BOM 제거
+            if (line.empty() == false && line.front() == L'\xFEFF')
+                line.remove_prefix(1);
+
+            // 앞뒤 공백 제거
+            const size_t first = line.find_first_not_of(whitespaces);
+            if (first == std::wstring_view::npos)
+                continue; // 빈 줄
+            const size_t last = line.find_last_not_of(whitespaces);
+            line = line.substr(first, last - first + 1);
+
+            if (line.front() == L'#')
+                continue; // 주석
+
+            const size_t separator = line.find_first_of(L" \t");
+            if (separator == std::wstring_view::npos)
+                return MAKE_ERROR(eErrorCode::InvalidUsersFile); // 출력 경로 누락
+
+            const size_t outputBegin = line.find_first_not_of(L" \t", separator);
+            ASSERT(outputBegin != std::wstring_view::npos); // 끝 공백은 위에서 제거됨
+
+            RenderJob job;
+            job.mUserName = line.substr(0, separator);
+            job.mOutputPath = line.substr(outputBegin);
+            outJobs.emplace_back(std::move(job));
+        }
+
+        return MAKE_ERROR(eErrorCode::Succeeded);
+    }
+
+    void BatchRenderer::WorkerMain(_In_ const std::wstring& githubToken, _In_ const RenderOptions& renderOptions)
+    {
+        // curl 핸들, 캔버스/프레임 버퍼, FrameWriter 객체는 worker 수명 동안 재사용
+        // (WebPAnimEncoder는 재설정 API가 없어 FrameWriter::Initialize()가 작업마다 새로 만듦)
+        Renderer renderer;
+        renderer.Initialize(githubToken, renderOptions);
+
+        while (true)
+        {
+            const size_t jobIndex = mNextJobIndex.fetch_add(1);
+            if (jobIndex >= mJobs.size())
+                break;
+
+            const RenderJob& job = mJobs[jobIndex];
+            const Error error = renderer.Render(job.mUserName, job.mOutputPath);
+            if (error.IsFailed())
+            {
+                const std::lock_guard<std::mutex> lock(mFailureMutex);
+                std::wcerr << L"Failed to render " << job.mUserName << L" -> " << job.mOutputPath
+                    << L" (0x" << std::hex << static_cast<HRESULT>(error.GetErrorCode()) << std::dec << L")\n";
+                mFailures.emplace_back(jobIndex, error);
+                continue;
+            }
+
+            ++mSucceededCount;
+        }
+
+        renderer.Uninitialize();
+    }
+} // CoTigraphy
@@ -0,0 +1,99 @@
+﻿// \file BatchRenderer.hpp
+// \last_updated 2026-10-16
+// \author Oh Sungsik <ohsungsik@outlook.com>
+// \copyright (C) 2025. Oh Sungsik. All rights reserved.
+
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "RenderOptions.hpp"
+
+namespace CoTigraphy
+{
+    /**
+     * @brief 배치 렌더링 작업 하나 (사용자 이름, 출력 경로)
+     */
+    struct RenderJob
+    {
+        std::wstring mUserName; // GitHub 사용자 이름
+        std::wstring mOutputPath; // WebP 출력 경로
+    };
+
+    /**
+     * @brief 여러 사용자의 WebP 애니메이션을 한 프로세스에서 렌더링하는 클래스
+     * @details
+     * - 목록 파일에서 (사용자, 출력 경로) 쌍을 읽어 worker thread들에 분배
+     * - 각 worker는 Renderer 하나를 만들어 curl 핸들, 캔버스/프레임 버퍼, FrameWriter 객체를 작업 간에 재사용
+     *   (libwebp 인코더 핸들은 작업마다 새로 만듦)
+     * - 사용자별 실패(없는 사용자, 네트워크 오류, 저장 실패)는 기록만 하고 나머지 작업은 계속 진행
+     * - 모든 작업이 끝나면 처리량(renders/sec)을 출력
+     */
+    class BatchRenderer final
+    {
+    public:
+        explicit BatchRenderer() noexcept;
+        BatchRenderer(const BatchRenderer& other) = delete;
+        BatchRenderer(BatchRenderer&& other) = delete;
+
+        BatchRenderer& operator=(const BatchRenderer& rhs) = delete;
+        BatchRenderer& operator=(BatchRenderer&& rhs) = delete;
+
+        ~BatchRenderer();
+
+        /**
+         * @brief UTF-8 목록 파일을 읽어 렌더링 작업을 등록
+         * @param usersFilePath 목록 파일 경로
+         * @return 성공 시 Succeeded, 파일을 읽을 수 없거나 형식이 잘못되면 에러 코드
+         */
+        [[nodiscard]] Error LoadJobs(_In_ const std::wstring& usersFilePath);
+
+        /**
+         * @brief 등록된 모든 작업을 worker thread들로 렌더링
+         * @param githubToken GitHub Personal Access Token
+         * @param renderOptions 모든 작업에 공통으로 적용할 렌더링 옵션
+         * @param workerCount worker thread 수 (0이면 CPU 코어 수)
+         * @return 모든 작업이 성공하면 Succeeded, 아니면 처음 실패한 작업의 에러 코드
+         * @pre LoadJobs() 성공 이후 호출
+         * @pre GitHubContributionCalendarClient::GlobalInitialize() 이후 호출
+         */
+        [[nodiscard]] Error Run(_In_ const std::wstring& githubToken, _In_ const RenderOptions& renderOptions,
+                                _In_ const size_t workerCount);
+
+        /**
+         * @brief 등록된 작업 목록을 반환
+         */
+        [[nodiscard]] const std::vector<RenderJob>& GetJobs() const noexcept { return mJobs; }
+
+        /**
+         * @brief 목록 파일 내용을 작업 목록으로 파싱
+         * @param text 목록 파일 내용
+         * @param outJobs 파싱된 작업 목록
+         * @return 성공 시 Succeeded, 형식 오류 시 InvalidUsersFile
+         * @details
+         * - 한 줄에 "<user_name> <output>" 형식, 사용자 이름 뒤의 나머지 전체를 출력 경로로 사용 (공백 포함 가능)
+         * - 빈 줄과 '#'으로 시작하는 줄은 무시
+         */
+        [[nodiscard]] static Error ParseJobs(_In_ const std::wstring& text, _Out_ std::vector<RenderJob>& outJobs);
+
+    private:
+        /**
+         * @brief worker thread 진입점, 남은 작업이 없을 때까지 작업을 가져와 렌더링
+         * @param githubToken GitHub Personal Access Token
+         * @param renderOptions 렌더링 옵션
+         */
+        void WorkerMain(_In_ const std::wstring& githubToken, _In_ const RenderOptions& renderOptions);
+
+    private:
+        std::vector<RenderJob> mJobs;
+
+        std::atomic<size_t> mNextJobIndex{0}; // 다음에 가져갈 작업 인덱스
+        std::atomic<size_t> mSucceededCount{0}; // 성공한 작업 수
+
+        std::mutex mFailureMutex;
+        std::vector<std::pair<size_t, Error>> mFailures; // (작업 인덱스, 에러)
+    };
+} // CoTigraphy
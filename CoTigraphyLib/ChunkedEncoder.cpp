@@ -0,0 +1,244 @@
+﻿// \file ChunkedEncoder.cpp
+// \last_updated 2026-10-16
+// \author Oh Sungsik <ohsungsik@outlook.com>
+// \copyright (C) 2025. Oh Sungsik. All rights reserved.
+
+#include "pch.hpp"
+#include "ChunkedEncoder.hpp"
+
+#include <numeric>
+#include <thread>
+
+#include "Grid.hpp"
+#include "Worm.hpp"
+
+namespace CoTigraphy
+{
+    namespace
+    {
+        /**
+         * @brief Grid의 현재 상태를 Grid 생성자로 다시 만들 수 있는 GridData로 복사
+         * @param grid 복사할 Grid
+         * @param maxCount 원본 GridData의 최대 Contribution 횟수
+         * @param outGridData 복사 결과 (기존 버퍼를 재사용)
+         */
+        void CopyGridState(_In_ const Grid& grid, _In_ const uint64_t maxCount, _Out_ GridData& outGridData)
+        {
+            outGridData.mWeekCount = grid.GetWeekCount();
+            outGridData.mDayCount = grid.GetDayCount();
+            outGridData.mMaxCount = maxCount;
+
+            outGridData.mCells.resize(outGridData.mWeekCount);
+            for (size_t week = 0; week < outGridData.mWeekCount; ++week)
+            {
+                std::vector<GridCell>& cells = outGridData.mCells[week];
+                cells.resize(outGridData.mDayCount);
+                grid.ForEachCellInWeek(week, [&cells, week](const size_t day, const uint64_t count, const COLORREF color)
+                {
+                    cells[day] = GridCell{week, day, count, color};
+                });
+            }
+        }
+
+        /**
+         * @brief 프레임 framesPerChunk개마다 chunk를 나눠 chunk별 첫 이벤트 위치를 계산
+         * @param frameDurations 이벤트별 프레임 표시 시간 (FrameTimeline::Build(), 0: 앞 프레임에 합쳐짐)
+         * @param framesPerChunk chunk 하나의 프레임 수
+         * @param[out] outChunkBegins chunk별 첫 이벤트 위치, 마지막 원소는 이벤트 수 (chunk i = [i], [i + 1])
+         * @details
+         * - chunk는 항상 프레임이 시작하는 이벤트(시간이 0이 아닌 이벤트)에서 시작하므로
+         *   앞 프레임에 합쳐진 이벤트는 그 프레임과 같은 chunk에 들어감 (타임라인은 chunk와 무관)
+         */
+        void SplitChunks(_In_ const std::vector<int>& frameDurations, _In_ const size_t framesPerChunk,
+                         _Out_ std::vector<size_t>& outChunkBegins)
+        {
+            outChunkBegins.clear();
+
+            size_t frameCount = 0;
+            for (size_t eventIndex = 0; eventIndex < frameDurations.size(); ++eventIndex)
+            {
+                if (frameDurations[eventIndex] == 0)
+                    continue;
+
+                if (frameCount % framesPerChunk == 0)
+                    outChunkBegins.push_back(eventIndex);
+                ++frameCount;
+            }
+            outChunkBegins.push_back(frameDurations.size());
+        }
+    }
+
+    ChunkedEncoder::ChunkedEncoder() noexcept
+    = default;
+
+    ChunkedEncoder::~ChunkedEncoder()
+    = default;
+
+    void ChunkedEncoder::Initialize(_In_ const eFrameWriterType frameWriterType, _In_ const EncodeOptions& encodeOptions,
+                                    _In_ const size_t threadCount)
+    {
+        PRECONDITION(threadCount > 0);
+
+        // writer 종류가 바뀌면 기존 리소스는 모두 새로 만듦
+        if (mFrameWriterType != frameWriterType)
+            mChunkWorkers.clear();
+        mFrameWriterType = frameWriterType;
+
+        mChunkWorkers.resize(threadCount);
+        for (std::unique_ptr<ChunkWorker>& chunkWorker : mChunkWorkers)
+        {
+            if (chunkWorker != nullptr)
+                continue;
+
+            chunkWorker = std::make_unique<ChunkWorker>();
+            chunkWorker->mFrameWriter = FrameWriter::Create(mFrameWriterType);
+            POSTCONDITION(chunkWorker->mFrameWriter != nullptr);
+        }
+
+        // 재사용하는 writer도 이번 작업의 설정으로 인코딩
+        for (const std::unique_ptr<ChunkWorker>& chunkWorker : mChunkWorkers)
+            chunkWorker->mFrameWriter->SetEncodeOptions(encodeOptions);
+    }
+
+    Error ChunkedEncoder::Encode(_In_ const SimulationLog& simulationLog,
+                                 _In_ const GridCanvasContext& gridCanvasContext, _In_ const eTimeline timeline)
+    {
+        PRECONDITION(mChunkWorkers.empty() == false);
+
+        // 타임라인은 다른 렌더링 경로와 같은 규칙으로 만들고, chunk는 프레임 수로 나눔
+        FrameTimeline::Build(simulationLog.GetEvents(), timeline, mFrameDurations);
+        SplitChunks(mFrameDurations, mFramesPerChunk, mChunkBegins);
+        const size_t chunkCount = mChunkBegins.size() - 1;
+
+        mGridCanvasContext = gridCanvasContext;
+        mGridCanvasContext.mPixelFormat = mChunkWorkers.front()->mFrameWriter->GetPixelFormat(); // FrameWriter 입력 형식
+        mNextChunkIndex = 0;
+        mChunkData.resize(chunkCount);
+        mFailures.clear();
+
+        // 이벤트를 처음부터 한 번만 재생하며 chunk 경계마다 Grid 상태를 저장 (chunk마다 처음부터 재생하지 않음)
+        {
+            const std::vector<SimulationEvent>& events = simulationLog.GetEvents();
+            const GridData& gridData = simulationLog.GetGridData();
+
+            Grid grid(gridData);
+            Worm worm(grid);
+            mChunkGridData.resize(chunkCount);
+            for (size_t chunkIndex = 0, eventIndex = 0; chunkIndex < chunkCount; ++chunkIndex)
+            {
+                for (; eventIndex < mChunkBegins[chunkIndex]; ++eventIndex)
+                    worm.Apply(events[eventIndex]);
+
+                CopyGridState(grid, gridData.mMaxCount, mChunkGridData[chunkIndex]);
+            }
+        }
+
+        // chunk보다 많은 스레드는 만들지 않음
+        const size_t threadCount = std::min(mChunkWorkers.size(), chunkCount);
+
+        std::vector<std::thread> workers;
+        workers.reserve(threadCount);
+        for (size_t i = 0; i < threadCount; ++i)
+            workers.emplace_back(&ChunkedEncoder::WorkerMain, this, std::ref(*mChunkWorkers[i]),
+                                 std::cref(simulationLog));
+
+        for (std::thread& worker : workers)
+            worker.join();
+
+        if (mFailures.empty() == false)
+        {
+            // chunk 순서상 가장 먼저 실패한 에러를 반환
+            const auto& firstFailure = *std::min_element(mFailures.begin(), mFailures.end(),
+                                                         [](const auto& lhs, const auto& rhs)
+                                                         {
+                                                             return lhs.first < rhs.first;
+                                                         });
+            return firstFailure.second;
+        }
+
+        // chunk 순서대로 이어 붙임
+        RETURN_IF_FAILED(mStitchWriter.Initialize(mGridCanvasContext.mWidth, mGridCanvasContext.mHeight));
+        for (size_t chunkIndex = 0; chunkIndex < chunkCount; ++chunkIndex)
+        {
+            const int chunkDurationMs = std::accumulate(mFrameDurations.begin() + mChunkBegins[chunkIndex],
+                                                        mFrameDurations.begin() + mChunkBegins[chunkIndex + 1], 0);
+
+            if (mStitchWriter.AddAnimation(mChunkData[chunkIndex], chunkDurationMs) == false)
+                return MAKE_ERROR(eErrorCode::EncodingFailure);
+        }
+
+        return MAKE_ERROR(eErrorCode::Succeeded);
+    }
+
+    Error ChunkedEncoder::SaveToFile(_In_ const std::wstring& fileName)
+    {
+        return mStitchWriter.SaveToFile(fileName);
+    }
+
+    void ChunkedEncoder::WorkerMain(_Inout_ ChunkWorker& chunkWorker, _In_ const SimulationLog& simulationLog)
+    {
+        // 이전 작업의 버퍼가 충분히 크면 재할당하지 않음
+        chunkWorker.mGridCanvas.Create(mGridCanvasContext);
+
+        while (true)
+        {
+            const size_t chunkIndex = mNextChunkIndex.fetch_add(1);
+            if (chunkIndex >= mChunkData.size())
+                break;
+
+            const Error error = EncodeChunk(chunkWorker, simulationLog, chunkIndex, mChunkData[chunkIndex]);
+            if (error.IsFailed())
+            {
+                const std::lock_guard<std::mutex> lock(mFailureMutex);
+                mFailures.emplace_back(chunkIndex, error);
+            }
+        }
+    }
+
+    Error ChunkedEncoder::EncodeChunk(_Inout_ ChunkWorker& chunkWorker, _In_ const SimulationLog& simulationLog,
+                                      _In_ const size_t chunkIndex, _Out_ std::vector<uint8_t>& outData) const
+    {
+        const std::vector<SimulationEvent>& events = simulationLog.GetEvents();
+
+        const size_t beginIndex = mChunkBegins[chunkIndex];
+        const size_t endIndex = mChunkBegins[chunkIndex + 1];
+        PRECONDITION(beginIndex < endIndex);
+        PRECONDITION(mFrameDurations[beginIndex] > 0);
+
+        // chunk 시작 시점의 Grid에서 지렁이 구간 수만큼의 직전 이벤트만 다시 적용해 Worm 상태 복원
+        // (Grid에는 이미 반영된 값을 같은 순서로 다시 쓰므로 Grid 상태는 바뀌지 않음)
+        Grid grid(mChunkGridData[chunkIndex]);
+        Worm worm(grid);
+        const size_t replayCount = std::min(beginIndex, worm.GetWorm().size());
+        for (size_t eventIndex = beginIndex - replayCount; eventIndex < beginIndex; ++eventIndex)
+            worm.Apply(events[eventIndex]);
+
+        GridCanvas& gridCanvas = chunkWorker.mGridCanvas;
+        FrameWriter& frameWriter = *chunkWorker.mFrameWriter;
+
+        // chunk의 첫 프레임은 항상 캔버스 전체를 그린 키프레임
+        gridCanvas.Invalidate();
+        RETURN_IF_FAILED(frameWriter.Initialize(mGridCanvasContext.mWidth, mGridCanvasContext.mHeight));
+
+        // 앞 프레임에 합쳐진 이벤트는 캔버스에만 그리고, 변경 영역은 다음 프레임에 포함
+        RECT mergedDirtyRect{};
+        for (size_t eventIndex = beginIndex; eventIndex < endIndex; ++eventIndex)
+        {
+            worm.Apply(events[eventIndex]);
+            RETURN_IF_FAILED(gridCanvas.Render(grid, worm));
+
+            const RECT dirtyRect = gridCanvas.GetDirtyRect();
+            UnionRect(&mergedDirtyRect, &mergedDirtyRect, &dirtyRect);
+
+            const int durationMs = mFrameDurations[eventIndex];
+            if (durationMs == 0)
+                continue;
+
+            if (frameWriter.AddFrame(gridCanvas.GetBuffer(), mergedDirtyRect, durationMs) == false)
+                return MAKE_ERROR(eErrorCode::EncodingFailure);
+            SetRectEmpty(&mergedDirtyRect);
+        }
+
+        return frameWriter.Assemble(outData);
+    }
+} // CoTigraphy
@@ -0,0 +1,120 @@
+﻿// \file ChunkedEncoder.hpp
+// \last_updated 2026-10-16
+// \author Oh Sungsik <ohsungsik@outlook.com>
+// \copyright (C) 2025. Oh Sungsik. All rights reserved.
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "FrameWriter.hpp"
+#include "GridCanvas.hpp"
+#include "FrameTimeline.hpp"
+#include "SimulationLog.hpp"
+#include "WebPMuxWriter.hpp"
+
+namespace CoTigraphy
+{
+    /**
+     * @brief 프레임 구간(chunk)을 여러 스레드에서 나눠 인코딩한 뒤 하나의 WebP 애니메이션으로 조립하는 클래스
+     * @details
+     * - 이벤트 목록을 mFramesPerChunk 프레임씩 나누고, 각 chunk는 자신만의 GridCanvas/FrameWriter로 인코딩
+     * - chunk는 프레임이 시작하는 이벤트에서 나누므로 프레임 시간은 단일 파이프라인/SVG와 같음 (FrameTimeline)
+     * - chunk의 첫 프레임은 캔버스 전체를 그린 키프레임이므로 chunk끼리 서로 의존하지 않음
+     * - chunk 시작 시점의 Grid 상태는 Encode()에서 이벤트를 한 번만 재생하며 chunk 경계마다 저장 (BFS 없음)
+     * - 지렁이 위치는 구간 수만큼의 직전 이벤트로만 정해지므로 chunk마다 그 이벤트만 다시 적용
+     * - 인코딩된 chunk들은 WebPMuxWriter::AddAnimation()으로 재인코딩 없이 순서대로 이어 붙임
+     * - chunk 경계가 스레드 수와 무관하므로 스레드 수가 달라도 출력은 바이트 단위로 같음
+     *   (단일 파이프라인은 chunk 키프레임이 없으므로 프레임/시간만 같고 파일은 다름)
+     * - Initialize -> Encode -> SaveToFile 순으로 사용하며, 스레드별 리소스는 작업 간에 재사용
+     */
+    class ChunkedEncoder final
+    {
+    public:
+        explicit ChunkedEncoder() noexcept;
+        ChunkedEncoder(const ChunkedEncoder& other) = delete;
+        ChunkedEncoder(ChunkedEncoder&& other) = delete;
+
+        ChunkedEncoder& operator=(const ChunkedEncoder& rhs) = delete;
+        ChunkedEncoder& operator=(ChunkedEncoder&& rhs) = delete;
+
+        ~ChunkedEncoder();
+
+        /**
+         * @brief 인코딩 스레드 수와 chunk 인코딩 방식을 설정하고 스레드별 리소스를 준비
+         * @param frameWriterType chunk 하나를 인코딩할 writer 종류
+         * @param encodeOptions chunk writer의 인코딩 설정
+         * @param threadCount 인코딩 스레드 수
+         * @pre threadCount > 0
+         */
+        void Initialize(_In_ const eFrameWriterType frameWriterType, _In_ const EncodeOptions& encodeOptions,
+                        _In_ const size_t threadCount);
+
+        /**
+         * @brief 기록된 시뮬레이션 전체를 chunk 단위로 병렬 인코딩하고 하나의 애니메이션으로 조립
+         * @param simulationLog 초기 Grid와 프레임별 이벤트
+         * @param gridCanvasContext 캔버스 구성 정보
+         * @param timeline 이벤트별 프레임 시간 계산 방식
+         * @return 성공 시 Succeeded, 실패 시 가장 앞선 chunk의 에러 코드
+         * @pre Initialize() 이후 호출
+         */
+        [[nodiscard]] Error Encode(_In_ const SimulationLog& simulationLog,
+                                   _In_ const GridCanvasContext& gridCanvasContext, _In_ const eTimeline timeline);
+
+        /**
+         * @brief Encode()로 조립한 애니메이션을 파일로 저장
+         * @param fileName 저장할 파일 경로 (.webp 확장자만 허용)
+         * @return 성공 시 Succeeded, 실패 시 에러 코드
+         */
+        [[nodiscard]] Error SaveToFile(_In_ const std::wstring& fileName);
+
+    private:
+        /**
+         * @brief 인코딩 스레드 하나가 소유하는 리소스
+         */
+        struct ChunkWorker
+        {
+            GridCanvas mGridCanvas; // chunk 래스터화용 캔버스
+            std::unique_ptr<FrameWriter> mFrameWriter; // chunk 인코딩용 writer
+        };
+
+        /**
+         * @brief 인코딩 스레드 진입점, 남은 chunk가 없을 때까지 chunk를 가져와 인코딩
+         * @param chunkWorker 이 스레드가 사용할 리소스
+         * @param simulationLog 초기 Grid와 프레임별 이벤트
+         */
+        void WorkerMain(_Inout_ ChunkWorker& chunkWorker, _In_ const SimulationLog& simulationLog);
+
+        /**
+         * @brief chunk 하나를 래스터화/인코딩
+         * @param chunkWorker 이 스레드가 사용할 리소스
+         * @param simulationLog 초기 Grid와 프레임별 이벤트
+         * @param chunkIndex 인코딩할 chunk 번호
+         * @param[out] outData 인코딩된 WebP 파일 내용
+         * @return 성공 시 Succeeded, 실패 시 에러 코드
+         */
+        [[nodiscard]] Error EncodeChunk(_Inout_ ChunkWorker& chunkWorker, _In_ const SimulationLog& simulationLog,
+                                        _In_ const size_t chunkIndex, _Out_ std::vector<uint8_t>& outData) const;
+
+    private:
+        static constexpr size_t mFramesPerChunk = 64; // chunk 하나의 프레임 수 (출력이 이 값에 따라 결정되므로 스레드 수와 무관해야 함)
+
+        eFrameWriterType mFrameWriterType = eFrameWriterType::AnimEncoder;
+        std::vector<std::unique_ptr<ChunkWorker>> mChunkWorkers; // 스레드별 리소스
+
+        GridCanvasContext mGridCanvasContext; // 현재 작업의 캔버스 구성 정보
+        std::vector<int> mFrameDurations; // 현재 작업의 이벤트별 프레임 표시 시간 (FrameTimeline::Build())
+        std::vector<size_t> mChunkBegins; // chunk별 첫 이벤트 위치, 마지막 원소는 이벤트 수 (작업 간 재사용)
+        std::vector<GridData> mChunkGridData; // chunk별 시작 시점의 Grid 상태 (chunk 순서, 작업 간 재사용)
+        std::atomic<size_t> mNextChunkIndex{0}; // 다음에 가져갈 chunk 번호
+        std::vector<std::vector<uint8_t>> mChunkData; // chunk별 인코딩 결과 (chunk 순서)
+
+        std::mutex mFailureMutex;
+        std::vector<std::pair<size_t, Error>> mFailures; // (chunk 번호, 에러)
+
+        WebPMuxWriter mStitchWriter; // chunk들을 이어 붙인 최종 애니메이션
+    };
+} // CoTigraphy
@@ -1,5 +1,5 @@
 ﻿// \file CoTigraphy.cpp
-// \last_updated 2025-06-14
+// \last_updated 2026-10-16
 // \author Oh Sungsik <ohsungsik@outlook.com>
 // \copyright (C) 2025. Oh Sungsik. All rights reserved.
 
@@ -10,29 +10,132 @@
 #include <shellapi.h>
 #include <string_view>
 
+#include "BatchRenderer.hpp"
 #include "CommandLineParser.hpp"
 #include "GitHubContributionCalendarClient.hpp"
-#include "GridCanvas.hpp"
 #include "HandleLeakDetector.hpp"
 #include "MemoryLeakDetector.hpp"
+#include "Renderer.hpp"
 #include "VersionInfo.hpp"
-#include "WebPWriter.hpp"
-#include "Worm.hpp"
 
 namespace CoTigraphy
 {
-    Error Initialize(_Out_opt_ std::wstring& githubToken,
-                     _Out_opt_ std::wstring& userName,
-                     _Out_opt_ std::wstring& outputPath)
+    namespace
+    {
+        /**
+         * @brief 10진수 문자열을 size_t 값으로 변환
+         * @param value 변환할 문자열 (숫자 이외의 문자가 있으면 실패)
+         * @param outValue 변환 결과
+         * @return 변환 성공 여부 (빈 문자열, 숫자 이외의 문자, overflow 시 false)
+         */
+        bool TryParseSize(_In_ const std::wstring_view& value, _Out_ size_t& outValue) noexcept
+        {
+            outValue = 0;
+            if (value.empty())
+                return false;
+
+            size_t result = 0;
+            for (const wchar_t ch : value)
+            {
+                if (ch < L'0' || ch > L'9')
+                    return false;
+
+                const size_t digit = static_cast<size_t>(ch - L'0');
+                if (result > (std::numeric_limits<size_t>::max() - digit) / 10)
+                    return false;
+
+                result = result * 10 + digit;
+            }
+
+            outValue = result;
+            return true;
+        }
+
+        /**
+         * @brief 쉼표로 구분한 10진수 목록을 size_t 값들로 변환
+         * @param value 변환할 문자열 (예: "1,2,3")
+         * @param outValues 변환 결과 (목록 순서)
+         * @return 변환 성공 여부 (빈 항목, 0, 중복된 값이 있으면 false)
+         */
+        bool TryParseSizeList(_In_ const std::wstring_view& value, _Out_ std::vector<size_t>& outValues)
+        {
+            outValues.clear();
+
+            size_t itemBegin = 0;
+            while (itemBegin <= value.size())
+            {
+                size_t itemEnd = value.find(L',', itemBegin);
+                if (itemEnd == std::wstring_view::npos)
+                    itemEnd = value.size();
+
+                size_t item = 0;
+                if (TryParseSize(value.substr(itemBegin, itemEnd - itemBegin), item) == false || item == 0 ||
+                    std::find(outValues.begin(), outValues.end(), item) != outValues.end())
+                {
+                    outValues.clear();
+                    return false;
+                }
+
+                outValues.push_back(item);
+                itemBegin = itemEnd + 1;
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief 쉼표로 구분한 <셀 크기>:<셀 간격> 목록을 CellLayout 값들로 변환
+         * @param value 변환할 문자열 (예: "5:1,10:3,20:6")
+         * @param outCellLayouts 변환 결과 (목록 순서)
+         * @return 변환 성공 여부 (빈 항목, ':'가 없는 항목, 셀 크기 0, 중복된 셀 크기가 있으면 false)
+         * @details
+         * - 출력 경로는 셀 크기로 구분하므로 (<output>-<N>px) 같은 셀 크기는 간격이 달라도 중복으로 취급
+         */
+        bool TryParseCellLayoutList(_In_ const std::wstring_view& value, _Out_ std::vector<CellLayout>& outCellLayouts)
+        {
+            outCellLayouts.clear();
+
+            size_t itemBegin = 0;
+            while (itemBegin <= value.size())
+            {
+                size_t itemEnd = value.find(L',', itemBegin);
+                if (itemEnd == std::wstring_view::npos)
+                    itemEnd = value.size();
+
+                const std::wstring_view item = value.substr(itemBegin, itemEnd - itemBegin);
+                const size_t separator = item.find(L':');
+
+                CellLayout cellLayout;
+                if (separator == std::wstring_view::npos ||
+                    TryParseSize(item.substr(0, separator), cellLayout.mCellSize) == false ||
+                    TryParseSize(item.substr(separator + 1), cellLayout.mCellMargin) == false ||
+                    cellLayout.mCellSize == 0 ||
+                    std::any_of(outCellLayouts.begin(), outCellLayouts.end(), [&cellLayout](const CellLayout& other)
+                    {
+                        return other.mCellSize == cellLayout.mCellSize;
+                    }))
+                {
+                    outCellLayouts.clear();
+                    return false;
+                }
+
+                outCellLayouts.push_back(cellLayout);
+                itemBegin = itemEnd + 1;
+            }
+
+            return true;
+        }
+    }
+
+    Error Initialize(_Out_ RunOptions& runOptions)
     {
         CoTigraphy::MemoryLeakDetector::Initialize();
         CoTigraphy::HandleLeakDetector::Initialize();
 
-        githubToken.clear();
-        userName.clear();
+        runOptions = RunOptions{};
 
         CoTigraphy::CommandLineParser commandLineParser;
-        Error error = SetupCommandLineParser(commandLineParser, githubToken, userName, outputPath);
+        Error error = SetupCommandLineParser(commandLineParser, runOptions);
         if (error.IsFailed())
             return error;
 
@@ -48,17 +151,67 @@ namespace CoTigraphy
             return error;
         }
 
+        // 개별 인코딩 설정은 --encode_preset으로 정한 값을 덮어씀 (anim writer는 팔레트 캔버스를 인코딩)
+        const bool isPaletteCanvas = runOptions.mRenderOptions.mFrameWriterType == eFrameWriterType::AnimEncoder;
+        if (runOptions.mEncodeOverrides.empty() == false &&
+            EncodeOptions::ParseOverrides(runOptions.mEncodeOverrides, isPaletteCanvas,
+                                          runOptions.mRenderOptions.mEncodeOptions).IsFailed())
+            runOptions.mInvalidOptions.emplace_back(L"--encode_options");
+
+        // 이벤트 기록 옵션은 단일 렌더링 전용이므로 배치 렌더링이나 기록 재생과 함께 쓰면 무시하지 않고 거부
+        const bool hasUsersFile = runOptions.mUsersFilePath.empty() == false;
+        const bool hasEventsIn = runOptions.mEventsInPath.empty() == false;
+        if (runOptions.mEventsOutPath.empty() == false && (hasUsersFile || hasEventsIn))
+            runOptions.mInvalidOptions.emplace_back(L"--events_out");
+        if (hasEventsIn && hasUsersFile)
+            runOptions.mInvalidOptions.emplace_back(L"--events_in");
+
+        // 출력 크기는 셀 크기/간격과 배율의 조합으로 정해지므로 모든 옵션을 읽은 뒤 검사 (--sizes/--scales는 모든 조합)
+        const RenderOptions& renderOptions = runOptions.mRenderOptions;
+        const bool hasCellLayouts = renderOptions.mCellLayouts.empty() == false;
+        const bool hasScales = renderOptions.mScales.empty() == false;
+        std::vector<CellLayout> cellLayouts = renderOptions.mCellLayouts;
+        if (hasCellLayouts == false)
+            cellLayouts.push_back({renderOptions.mCellSize, renderOptions.mCellMargin});
+        const std::vector<size_t> scales = hasScales ? renderOptions.mScales : std::vector<size_t>{renderOptions.mScale};
+        for (const CellLayout& cellLayout : cellLayouts)
+        {
+            if (Renderer::IsOutputSizeSupported(Renderer::mMaxCalendarWeekCount, cellLayout.mCellSize,
+                                                cellLayout.mCellMargin, 1) == false)
+            {
+                runOptions.mInvalidOptions.emplace_back(hasCellLayouts ? L"--sizes" : L"--cell_size");
+                break;
+            }
+
+            const bool isScaleSupported = std::all_of(scales.begin(), scales.end(), [&cellLayout](const size_t scale)
+            {
+                return Renderer::IsOutputSizeSupported(Renderer::mMaxCalendarWeekCount, cellLayout.mCellSize,
+                                                       cellLayout.mCellMargin, scale);
+            });
+            if (isScaleSupported == false)
+            {
+                runOptions.mInvalidOptions.emplace_back(hasScales ? L"--scales" : L"--scale");
+                break;
+            }
+        }
+
+        // 값 형식이 잘못된 옵션이 있으면 help 출력
+        if (runOptions.mInvalidOptions.empty() == false)
+        {
+            for (const std::wstring& optionName : runOptions.mInvalidOptions)
+                std::wcout << L"Invalid value for option: " << optionName << L"\n";
+
+            commandLineParser.PrintHelpTo(std::wcout);
+            return MAKE_ERROR(eErrorCode::InvalidArguments);
+        }
+
         return MAKE_ERROR(eErrorCode::Succeeded);
     }
 
     Error SetupCommandLineParser(_In_ CoTigraphy::CommandLineParser& commandLineParser,
-                                 _Out_opt_ std::wstring& githubToken,
-                                 _Out_opt_ std::wstring& userName,
-                                 _Out_opt_ std::wstring& outputPath)
+                                 _Out_ RunOptions& runOptions)
     {
-        githubToken.clear();
-        userName.clear();
-        outputPath.clear();
+        runOptions = RunOptions{};
 
         Error error = commandLineParser.AddOption(CommandLineOption{
             L"--help", // mName
@@ -108,7 +261,7 @@ namespace CoTigraphy
             false, // mCausesExit
             [&](const std::wstring_view& value) // mHandler
             {
-                githubToken = value;
+                runOptions.mGithubToken = value;
             }
         });
         if (error.IsFailed())
@@ -125,7 +278,7 @@ namespace CoTigraphy
             false, // mCausesExit
             [&](const std::wstring_view& value) // mHandler
             {
-                userName = value;
+                runOptions.mUserName = value;
             }
         });
         if (error.IsFailed())
@@ -137,12 +290,12 @@ namespace CoTigraphy
         error = commandLineParser.AddOption(CommandLineOption{
             L"--output", // mName
             L"-o", // mShortName
-            L"Output Path", // mDescription
+            L"Output Path (.webp, or .svg for an animated SVG)", // mDescription
             true, // mRequiresValue
             false, // mCausesExit
             [&](const std::wstring_view& value) // mHandler
             {
-                outputPath = value;
+                runOptions.mOutputPath = value;
             }
         });
         if (error.IsFailed())
@@ -151,68 +304,368 @@ namespace CoTigraphy
             return error;
         }
 
-        return MAKE_ERROR(eErrorCode::Succeeded);
-    }
+        error = commandLineParser.AddOption(CommandLineOption{
+            L"--users_file", // mName
+            L"-u", // mShortName
+            L"Batch render list file (one '<user_name> <output>' per line)", // mDescription
+            true, // mRequiresValue
+            false, // mCausesExit
+            [&](const std::wstring_view& value) // mHandler
+            {
+                runOptions.mUsersFilePath = value;
+            }
+        });
+        if (error.IsFailed())
+        {
+            ASSERT(error.IsSucceeded());
+            return error;
+        }
 
-    Error Run(_In_ const std::wstring& githubToken, _In_ const std::wstring& userName,
-              _In_ const std::wstring& outputPath)
-    {
-        GitHubContributionCalendarClient contributionCalendarClient;
-        contributionCalendarClient.Initialize();
-        contributionCalendarClient.SetAccessToken(githubToken);
+        error = commandLineParser.AddOption(CommandLineOption{
+            L"--jobs", // mName
+            L"-j", // mShortName
+            L"Worker thread count for --users_file (default: CPU count)", // mDescription
+            true, // mRequiresValue
+            false, // mCausesExit
+            [&](const std::wstring_view& value) // mHandler
+            {
+                if (TryParseSize(value, runOptions.mWorkerCount) == false)
+                    runOptions.mInvalidOptions.emplace_back(L"--jobs");
+            }
+        });
+        if (error.IsFailed())
+        {
+            ASSERT(error.IsSucceeded());
+            return error;
+        }
 
-        const std::wstring reuiqredFields = L"date contributionCount color"; // 필요한 field
-        const GridData gridData = contributionCalendarClient.FetchContributionInfo(userName, reuiqredFields);
-        contributionCalendarClient.Uninitialize();
+        error = commandLineParser.AddOption(CommandLineOption{
+            L"--writer", // mName
+            L"-w", // mShortName
+            L"WebP writer: 'anim' (WebPAnimEncoder, default) or 'mux' (encode changed area only)", // mDescription
+            true, // mRequiresValue
+            false, // mCausesExit
+            [&](const std::wstring_view& value) // mHandler
+            {
+                if (value == L"anim")
+                    runOptions.mRenderOptions.mFrameWriterType = eFrameWriterType::AnimEncoder;
+                else if (value == L"mux")
+                    runOptions.mRenderOptions.mFrameWriterType = eFrameWriterType::SubRectMux;
+                else
+                    runOptions.mInvalidOptions.emplace_back(L"--writer");
+            }
+        });
+        if (error.IsFailed())
+        {
+            ASSERT(error.IsSucceeded());
+            return error;
+        }
 
-        constexpr int cellSize = 10; // 각 칸 크기 (px)
-        constexpr int cellMargin = 3; // 칸 간격 (px)
-        constexpr int daysPerWeek = 7; // Sunday~Saturday (7 rows)
+        error = commandLineParser.AddOption(CommandLineOption{
+            L"--encode_threads", // mName
+            L"-p", // mShortName
+            L"Encode frame chunks in parallel on this many threads (default: 0, single pipeline)", // mDescription
+            true, // mRequiresValue
+            false, // mCausesExit
+            [&](const std::wstring_view& value) // mHandler
+            {
+                if (TryParseSize(value, runOptions.mRenderOptions.mEncodeThreadCount) == false)
+                    runOptions.mInvalidOptions.emplace_back(L"--encode_threads");
+            }
+        });
+        if (error.IsFailed())
+        {
+            ASSERT(error.IsSucceeded());
+            return error;
+        }
 
-        const size_t width = gridData.mWeekCount * (cellSize + cellMargin) - cellMargin;
-        constexpr size_t height = daysPerWeek * (cellSize + cellMargin) - cellMargin;
+        error = commandLineParser.AddOption(CommandLineOption{
+            L"--encode_preset", // mName
+            L"-q", // mShortName
+            L"Encoder speed/size trade-off: 'fast', 'balanced' (default) or 'smallest'", // mDescription
+            true, // mRequiresValue
+            false, // mCausesExit
+            [&](const std::wstring_view& value) // mHandler
+            {
+                eEncodePreset encodePreset = eEncodePreset::Balanced;
+                if (EncodeOptions::ParsePreset(value, encodePreset).IsFailed())
+                    runOptions.mInvalidOptions.emplace_back(L"--encode_preset");
+                else
+                    runOptions.mRenderOptions.mEncodeOptions = EncodeOptions::FromPreset(encodePreset);
+            }
+        });
+        if (error.IsFailed())
+        {
+            ASSERT(error.IsSucceeded());
+            return error;
+        }
 
-        GridCanvasContext context;
-        context.mWidth = static_cast<int>(width);
-        context.mHeight = height;
-        context.mCellSize = cellSize;
-        context.mCellMargin = cellMargin;
+        error = commandLineParser.AddOption(CommandLineOption{
+            L"--encode_options", // mName
+            L"-g", // mShortName
+            L"Override individual encoder options after the preset, e.g. 'method=6,kmax=10' "
+            L"(quality, method, lossless, near_lossless, thread_level, exact, kmin, kmax, minimize_size, allow_mixed, palette)", // mDescription
+            true, // mRequiresValue
+            false, // mCausesExit
+            [&](const std::wstring_view& value) // mHandler
+            {
+                runOptions.mEncodeOverrides = value;
+            }
+        });
+        if (error.IsFailed())
+        {
+            ASSERT(error.IsSucceeded());
+            return error;
+        }
 
-        GridCanvas gridCanvas;
-        gridCanvas.Create(context);
+        error = commandLineParser.AddOption(CommandLineOption{
+            L"--route", // mName
+            L"-r", // mShortName
+            L"Eating order: 'greedy' (nearest target each time, default) or 'optimized' (plan each level's order)", // mDescription
+            true, // mRequiresValue
+            false, // mCausesExit
+            [&](const std::wstring_view& value) // mHandler
+            {
+                if (value == L"greedy")
+                    runOptions.mRenderOptions.mRouteStrategy = eRouteStrategy::Greedy;
+                else if (value == L"optimized")
+                    runOptions.mRenderOptions.mRouteStrategy = eRouteStrategy::Optimized;
+                else
+                    runOptions.mInvalidOptions.emplace_back(L"--route");
+            }
+        });
+        if (error.IsFailed())
+        {
+            ASSERT(error.IsSucceeded());
+            return error;
+        }
 
-        Grid grid(gridData);
-        Worm worm(grid);
+        error = commandLineParser.AddOption(CommandLineOption{
+            L"--timeline", // mName
+            L"-l", // mShortName
+            L"Frame timing: 'uniform' (80 ms per move, default) or 'dynamic' (pause on eating, fast travel, end hold)", // mDescription
+            true, // mRequiresValue
+            false, // mCausesExit
+            [&](const std::wstring_view& value) // mHandler
+            {
+                if (value == L"uniform")
+                    runOptions.mRenderOptions.mTimeline = eTimeline::Uniform;
+                else if (value == L"dynamic")
+                    runOptions.mRenderOptions.mTimeline = eTimeline::Dynamic;
+                else
+                    runOptions.mInvalidOptions.emplace_back(L"--timeline");
+            }
+        });
+        if (error.IsFailed())
+        {
+            ASSERT(error.IsSucceeded());
+            return error;
+        }
 
-        WebPWriter webPWriter;
-        webPWriter.Initialize(context.mWidth, context.mHeight);
+        error = commandLineParser.AddOption(CommandLineOption{
+            L"--cell_size", // mName
+            L"-z", // mShortName
+            L"Cell size in logical pixels (default: 10, the output must fit in 16383 x 16383 pixels)", // mDescription
+            true, // mRequiresValue
+            false, // mCausesExit
+            [&](const std::wstring_view& value) // mHandler
+            {
+                if (TryParseSize(value, runOptions.mRenderOptions.mCellSize) == false ||
+                    runOptions.mRenderOptions.mCellSize == 0)
+                    runOptions.mInvalidOptions.emplace_back(L"--cell_size");
+            }
+        });
+        if (error.IsFailed())
+        {
+            ASSERT(error.IsSucceeded());
+            return error;
+        }
 
-        uint64_t currentLevel = 1;
-        while (true)
+        error = commandLineParser.AddOption(CommandLineOption{
+            L"--cell_margin", // mName
+            L"-m", // mShortName
+            L"Gap between cells in logical pixels (default: 3, 0: no gap)", // mDescription
+            true, // mRequiresValue
+            false, // mCausesExit
+            [&](const std::wstring_view& value) // mHandler
+            {
+                if (TryParseSize(value, runOptions.mRenderOptions.mCellMargin) == false)
+                    runOptions.mInvalidOptions.emplace_back(L"--cell_margin");
+            }
+        });
+        if (error.IsFailed())
         {
-            bool ret = worm.Move(currentLevel);
-            if (ret == false)
+            ASSERT(error.IsSucceeded());
+            return error;
+        }
+
+        error = commandLineParser.AddOption(CommandLineOption{
+            L"--scale", // mName
+            L"-s", // mShortName
+            L"Output scale: draw each logical pixel as an N x N block for HiDPI screens (default: 1)", // mDescription
+            true, // mRequiresValue
+            false, // mCausesExit
+            [&](const std::wstring_view& value) // mHandler
             {
-                currentLevel++;
+                if (TryParseSize(value, runOptions.mRenderOptions.mScale) == false ||
+                    runOptions.mRenderOptions.mScale == 0)
+                    runOptions.mInvalidOptions.emplace_back(L"--scale");
+            }
+        });
+        if (error.IsFailed())
+        {
+            ASSERT(error.IsSucceeded());
+            return error;
+        }
 
-                if (currentLevel > gridData.mMaxCount)
-                    break;
+        error = commandLineParser.AddOption(CommandLineOption{
+            L"--scales", // mName
+            L"-x", // mShortName
+            L"Comma-separated output scales rendered from one simulation, e.g. '1,2' (writes <output>@<N>x.webp for N > 1)", // mDescription
+            true, // mRequiresValue
+            false, // mCausesExit
+            [&](const std::wstring_view& value) // mHandler
+            {
+                if (TryParseSizeList(value, runOptions.mRenderOptions.mScales) == false)
+                    runOptions.mInvalidOptions.emplace_back(L"--scales");
+            }
+        });
+        if (error.IsFailed())
+        {
+            ASSERT(error.IsSucceeded());
+            return error;
+        }
 
-                continue;
+        error = commandLineParser.AddOption(CommandLineOption{
+            L"--sizes", // mName
+            L"-y", // mShortName
+            L"Comma-separated <cell_size>:<cell_margin> pairs rendered from one simulation, e.g. '5:1,10:3' (writes <output>-<cell_size>px.webp for each)", // mDescription
+            true, // mRequiresValue
+            false, // mCausesExit
+            [&](const std::wstring_view& value) // mHandler
+            {
+                if (TryParseCellLayoutList(value, runOptions.mRenderOptions.mCellLayouts) == false)
+                    runOptions.mInvalidOptions.emplace_back(L"--sizes");
             }
+        });
+        if (error.IsFailed())
+        {
+            ASSERT(error.IsSucceeded());
+            return error;
+        }
 
-            gridCanvas.Clear(RGB(0x01, 0x04, 0x09));
-            gridCanvas.DrawGrid(grid);
-            gridCanvas.DrawWorm(worm);
+        error = commandLineParser.AddOption(CommandLineOption{
+            L"--cell_radius", // mName
+            L"-c", // mShortName
+            L"Round cell corners with this radius in pixels (default: 0, square; edges are anti-aliased)", // mDescription
+            true, // mRequiresValue
+            false, // mCausesExit
+            [&](const std::wstring_view& value) // mHandler
+            {
+                if (TryParseSize(value, runOptions.mRenderOptions.mCellRadius) == false)
+                    runOptions.mInvalidOptions.emplace_back(L"--cell_radius");
+            }
+        });
+        if (error.IsFailed())
+        {
+            ASSERT(error.IsSucceeded());
+            return error;
+        }
 
-            ret = webPWriter.AddFrame(gridCanvas.GetBuffer());
-            ASSERT(ret == true);
+        error = commandLineParser.AddOption(CommandLineOption{
+            L"--themes", // mName
+            L"-k", // mShortName
+            L"Comma-separated color themes rendered from one simulation: 'dark', 'light' (writes <output>-<theme>.webp)", // mDescription
+            true, // mRequiresValue
+            false, // mCausesExit
+            [&](const std::wstring_view& value) // mHandler
+            {
+                if (ColorTheme::ParseList(value, runOptions.mRenderOptions.mThemes).IsFailed())
+                    runOptions.mInvalidOptions.emplace_back(L"--themes");
+            }
+        });
+        if (error.IsFailed())
+        {
+            ASSERT(error.IsSucceeded());
+            return error;
         }
 
-        const Error error = webPWriter.SaveToFile(outputPath);
+        error = commandLineParser.AddOption(CommandLineOption{
+            L"--events_out", // mName
+            L"-e", // mShortName
+            L"Save the simulation event log to this path", // mDescription
+            true, // mRequiresValue
+            false, // mCausesExit
+            [&](const std::wstring_view& value) // mHandler
+            {
+                runOptions.mEventsOutPath = value;
+            }
+        });
+        if (error.IsFailed())
+        {
+            ASSERT(error.IsSucceeded());
+            return error;
+        }
+
+        error = commandLineParser.AddOption(CommandLineOption{
+            L"--events_in", // mName
+            L"-i", // mShortName
+            L"Render a saved simulation event log instead of fetching from GitHub", // mDescription
+            true, // mRequiresValue
+            false, // mCausesExit
+            [&](const std::wstring_view& value) // mHandler
+            {
+                runOptions.mEventsInPath = value;
+            }
+        });
         if (error.IsFailed())
+        {
+            ASSERT(error.IsSucceeded());
             return error;
+        }
 
         return MAKE_ERROR(eErrorCode::Succeeded);
     }
+
+    Error Run(_In_ const RunOptions& runOptions)
+    {
+        // curl 전역 초기화는 스레드 안전하지 않으므로 worker 생성 전에 한 번만 수행
+        GitHubContributionCalendarClient::GlobalInitialize();
+
+        Error error = MAKE_ERROR(eErrorCode::Succeeded);
+        if (runOptions.mUsersFilePath.empty() == false)
+        {
+            BatchRenderer batchRenderer;
+            error = batchRenderer.LoadJobs(runOptions.mUsersFilePath);
+            if (error.IsSucceeded())
+                error = batchRenderer.Run(runOptions.mGithubToken, runOptions.mRenderOptions,
+                                          runOptions.mWorkerCount);
+        }
+        else if (runOptions.mEventsInPath.empty() == false)
+        {
+            // 기록된 시뮬레이션 재생, GitHub API를 호출하지 않음
+            SimulationLog simulationLog;
+            error = simulationLog.LoadFromFile(runOptions.mEventsInPath);
+            if (error.IsSucceeded())
+            {
+                Renderer renderer;
+                renderer.Initialize(runOptions.mGithubToken, runOptions.mRenderOptions);
+                error = renderer.RenderSimulationLog(simulationLog, runOptions.mOutputPath);
+                renderer.Uninitialize();
+            }
+        }
+        else
+        {
+            Renderer renderer;
+            renderer.Initialize(runOptions.mGithubToken, runOptions.mRenderOptions);
+            error = renderer.Render(runOptions.mUserName, runOptions.mOutputPath);
+            if (error.IsSucceeded() && runOptions.mEventsOutPath.empty() == false)
+                error = renderer.GetSimulationLog().SaveToFile(runOptions.mEventsOutPath);
+            renderer.Uninitialize();
+        }
+
+        GitHubContributionCalendarClient::GlobalUninitialize();
+
+        return error;
+    }
 } // namespace CoTigraphy
@@ -1,52 +1,74 @@
 ﻿// \file CoTigraphy.hpp
-// \last_updated 2025-06-14
+// \last_updated 2026-10-16
 // \author Oh Sungsik <ohsungsik@outlook.com>
 // \copyright (C) 2025. Oh Sungsik. All rights reserved.
 
 #pragma once
 
+#include <string>
+#include <vector>
+
+#include "RenderOptions.hpp"
+
 namespace CoTigraphy
 {
     // 전방 선언
     class CommandLineParser;
 
+    /**
+     * @brief 명령줄에서 추출한 실행 옵션 구조체
+     * @details
+     * - mUsersFilePath가 비어 있으면 mUserName/mOutputPath 한 건을 렌더링
+     * - mUsersFilePath가 지정되면 목록 파일의 모든 (사용자, 출력 경로)를 배치 렌더링
+     */
+    struct RunOptions
+    {
+        std::wstring mGithubToken; // GitHub Personal Access Token
+        std::wstring mUserName; // GitHub 사용자 이름
+        std::wstring mOutputPath; // WebP 출력 경로
+        std::wstring mUsersFilePath; // 배치 렌더링 목록 파일 경로 (한 줄에 "<user_name> <output>")
+        size_t mWorkerCount = 0; // 배치 렌더링 worker thread 수 (0이면 CPU 코어 수)
+        std::wstring mEventsOutPath; // 시뮬레이션 기록을 저장할 경로 (단일 렌더링 전용)
+        std::wstring mEventsInPath; // 지정되면 GitHub API 대신 이 시뮬레이션 기록을 렌더링 (단일 렌더링 전용)
+        RenderOptions mRenderOptions; // 렌더링/출력 방식
+        std::wstring mEncodeOverrides; // --encode_options 값 (옵션 순서와 관계없이 --encode_preset 뒤에 적용)
+
+        std::vector<std::wstring> mInvalidOptions; // 값 해석에 실패했거나 함께 쓸 수 없는 옵션 이름 목록
+    };
+
     /**
      * @brief 프로그램 전체 초기화 함수
-     * @param[out] githubToken GitHub Personal Access Token (명령줄에서 추출)
-     * @param[out] userName GitHub 사용자 이름 (명령줄에서 추출)
-     * @param[out] outputPath WebP 출력 경로
+     * @param[out] runOptions 명령줄에서 추출한 실행 옵션
      * @return 성공 시 Succeeded, 실패 시 에러 코드
      * @details
      * - 메모리/핸들 릭 감지기 초기화
      * - 명령줄 파서 초기화 및 파싱 수행
+     * - --events_out을 --users_file/--events_in과, --events_in을 --users_file과 함께 쓰면 InvalidArguments
      */
-    Error Initialize(_Out_opt_ std::wstring& githubToken, _Out_opt_ std::wstring& userName,
-                     _Out_opt_ std::wstring& outputPath);
+    Error Initialize(_Out_ RunOptions& runOptions);
 
     /**
      * @brief 명령줄 파서 구성 함수
      * @param[in,out] commandLineParser 파서를 구성할 CommandLineParser 인스턴스
-     * @param[out] githubToken 사용자 입력으로 받은 토큰 값
-     * @param[out] userName 사용자 입력으로 받은 이름 값
-     * @param[out] outputPath 사용자 입력으로 받은 WebP 출력 경로
+     * @param[out] runOptions 사용자 입력으로 받은 실행 옵션
      * @return 성공 시 Succeeded, 실패 시 에러 코드
      * @details
-     * - "--help", "--version", "--token", "--userName" 옵션을 등록
+     * - "--help", "--version", "--token", "--user_name", "--output", "--users_file", "--jobs", "--writer", "--encode_threads",
+     *   "--encode_preset", "--encode_options", "--route", "--timeline", "--cell_size", "--cell_margin", "--scale", "--scales",
+     *   "--sizes", "--cell_radius", "--themes", "--events_out", "--events_in" 옵션을 등록
      */
     Error SetupCommandLineParser(_In_ CoTigraphy::CommandLineParser& commandLineParser,
-                                 _Out_opt_ std::wstring& githubToken, _Out_opt_ std::wstring& userName,
-                                 _Out_opt_ std::wstring& outputPath);
+                                 _Out_ RunOptions& runOptions);
 
 
     /**
      * @brief GitHub Contribution calendar를 이용해 애니메이션 WebP를 생성
-     * @param[in] githubToken Personal Access Token
-     * @param[in] userName GitHub 사용자 이름
-     * @param[out] outputPath WebP 출력 경로
+     * @param[in] runOptions 실행 옵션
      * @return 성공 시 Succeeded, 실패 시 에러 코드
      * @details
      * - API로 기여 정보 가져오기 -> Worm 시뮬레이션 -> WebP 프레임 생성 -> 파일 저장
+     * - mUsersFilePath가 지정된 경우 BatchRenderer로 목록 전체를 렌더링
+     * - mEventsInPath가 지정된 경우 API 호출과 시뮬레이션 없이 기록된 이벤트를 렌더링
      */
-    Error Run(_In_ const std::wstring& githubToken, _In_ const std::wstring& userName,
-              _In_ const std::wstring& outputPath);
+    Error Run(_In_ const RunOptions& runOptions);
 } // namespace CoTigraphy
@@ -0,0 +1,96 @@
+﻿// \file ColorTheme.cpp
+// \last_updated 2026-10-16
+// \author Oh Sungsik <ohsungsik@outlook.com>
+// \copyright (C) 2025. Oh Sungsik. All rights reserved.
+
+#include "pch.hpp"
+#include "ColorTheme.hpp"
+
+namespace CoTigraphy
+{
+    namespace
+    {
+        // GitHub API가 주는 Contribution 색상 (light 팔레트, 0 ~ 4단계)
+        constexpr COLORREF githubLevel0 = RGB(0xEB, 0xED, 0xF0);
+        constexpr COLORREF githubLevel1 = RGB(0x9B, 0xE9, 0xA8);
+        constexpr COLORREF githubLevel2 = RGB(0x40, 0xC4, 0x63);
+        constexpr COLORREF githubLevel3 = RGB(0x30, 0xA1, 0x4E);
+        constexpr COLORREF githubLevel4 = RGB(0x21, 0x6E, 0x39);
+
+        // 지렁이가 먹은 셀의 색상 (Worm::Move())
+        constexpr COLORREF eatenCellColor = RGB(0xFF, 0xFF, 0xFF);
+    }
+
+    Error ColorTheme::Find(_In_ const std::wstring_view& name, _Out_ ColorTheme& outColorTheme)
+    {
+        outColorTheme = ColorTheme{};
+        outColorTheme.mName = name;
+
+        if (name == L"dark")
+        {
+            // GitHub dark 팔레트, 먹은 셀은 빈 셀과 같은 색
+            outColorTheme.mBackgroundColor = RGB(0x0D, 0x11, 0x17);
+            outColorTheme.mColorTable = {
+                {githubLevel0, RGB(0x16, 0x1B, 0x22)},
+                {githubLevel1, RGB(0x0E, 0x44, 0x29)},
+                {githubLevel2, RGB(0x00, 0x6D, 0x32)},
+                {githubLevel3, RGB(0x26, 0xA6, 0x41)},
+                {githubLevel4, RGB(0x39, 0xD3, 0x53)},
+                {eatenCellColor, RGB(0x16, 0x1B, 0x22)},
+            };
+            return MAKE_ERROR(eErrorCode::Succeeded);
+        }
+
+        if (name == L"light")
+        {
+            // API 색상이 light 팔레트이므로 먹은 셀만 흰 배경과 구분되게 바꿈
+            outColorTheme.mBackgroundColor = RGB(0xFF, 0xFF, 0xFF);
+            outColorTheme.mColorTable = {
+                {eatenCellColor, githubLevel0},
+            };
+            return MAKE_ERROR(eErrorCode::Succeeded);
+        }
+
+        return MAKE_ERROR(eErrorCode::InvalidArguments);
+    }
+
+    Error ColorTheme::ParseList(_In_ const std::wstring_view& names, _Out_ std::vector<ColorTheme>& outColorThemes)
+    {
+        outColorThemes.clear();
+
+        size_t nameBegin = 0;
+        while (nameBegin <= names.size())
+        {
+            size_t nameEnd = names.find(L',', nameBegin);
+            if (nameEnd == std::wstring_view::npos)
+                nameEnd = names.size();
+
+            const std::wstring_view name = names.substr(nameBegin, nameEnd - nameBegin);
+            nameBegin = nameEnd + 1;
+
+            // 같은 테마를 두 번 그리면 출력 파일이 겹침
+            const bool isDuplicated = std::any_of(outColorThemes.begin(), outColorThemes.end(),
+                                                  [&name](const ColorTheme& colorTheme)
+                                                  {
+                                                      return colorTheme.mName == name;
+                                                  });
+            if (isDuplicated)
+            {
+                outColorThemes.clear();
+                return MAKE_ERROR(eErrorCode::InvalidArguments);
+            }
+
+            ColorTheme colorTheme;
+            const Error error = Find(name, colorTheme);
+            if (error.IsFailed())
+            {
+                outColorThemes.clear();
+                return error;
+            }
+
+            outColorThemes.emplace_back(std::move(colorTheme));
+        }
+
+        return MAKE_ERROR(eErrorCode::Succeeded);
+    }
+} // CoTigraphy
@@ -0,0 +1,47 @@
+﻿// \file ColorTheme.hpp
+// \last_updated 2026-10-16
+// \author Oh Sungsik <ohsungsik@outlook.com>
+// \copyright (C) 2025. Oh Sungsik. All rights reserved.
+
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "Error.hpp"
+
+namespace CoTigraphy
+{
+    /**
+     * @brief 한 번의 시뮬레이션을 여러 색상으로 출력할 때 사용하는 색상 테마
+     * @details
+     * - 배경 색상과 셀 색상 변환표(원래 색상 -> 테마 색상)로 구성
+     * - 변환표는 GridCanvas가 타일을 래스터화할 때 적용하므로 Grid/SimulationLog의 색상은 바꾸지 않음
+     * - 변환표에 없는 색상(지렁이 등)은 그대로 그림
+     */
+    struct ColorTheme
+    {
+        std::wstring mName; // 테마 이름 (출력 파일 이름에 붙음)
+        COLORREF mBackgroundColor = RGB(0x01, 0x04, 0x09); // 셀 사이 여백(배경) 색상
+        std::vector<std::pair<COLORREF, COLORREF>> mColorTable; // (GitHub API 색상, 테마 색상)
+
+        /**
+         * @brief 기본 제공 테마를 이름으로 찾음
+         * @param name 테마 이름 ("dark" 또는 "light")
+         * @param outColorTheme 찾은 테마
+         * @return 성공 시 Succeeded, 모르는 이름이면 InvalidArguments
+         */
+        [[nodiscard]] static Error Find(_In_ const std::wstring_view& name, _Out_ ColorTheme& outColorTheme);
+
+        /**
+         * @brief 쉼표로 구분한 테마 이름 목록을 파싱
+         * @param names "dark,light" 형식의 목록
+         * @param outColorThemes 파싱한 테마 (목록 순서)
+         * @return 성공 시 Succeeded, 빈 이름/모르는 이름/중복된 이름이 있으면 InvalidArguments
+         */
+        [[nodiscard]] static Error ParseList(_In_ const std::wstring_view& names,
+                                             _Out_ std::vector<ColorTheme>& outColorThemes);
+    };
+} // CoTigraphy
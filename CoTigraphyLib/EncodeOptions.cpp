@@ -0,0 +1,197 @@
+﻿// \file EncodeOptions.cpp
+// \last_updated 2026-10-16
+// \author Oh Sungsik <ohsungsik@outlook.com>
+// \copyright (C) 2025. Oh Sungsik. All rights reserved.
+
+#include "pch.hpp"
+#include "EncodeOptions.hpp"
+
+namespace CoTigraphy
+{
+    namespace
+    {
+        /**
+         * @brief 10진수 문자열을 [minValue, maxValue] 범위의 int 값으로 변환
+         * @return 변환 성공 여부 (빈 문자열, 숫자 이외의 문자, 범위를 벗어나면 false)
+         */
+        bool TryParseInt(_In_ const std::wstring_view& value, _In_ const int minValue, _In_ const int maxValue,
+                         _Out_ int& outValue) noexcept
+        {
+            outValue = 0;
+            if (value.empty())
+                return false;
+
+            int64_t result = 0;
+            for (const wchar_t ch : value)
+            {
+                if (ch < L'0' || ch > L'9')
+                    return false;
+
+                result = result * 10 + (ch - L'0');
+                if (result > maxValue)
+                    return false;
+            }
+
+            if (result < minValue)
+                return false;
+
+            outValue = static_cast<int>(result);
+            return true;
+        }
+    }
+
+    EncodeOptions EncodeOptions::FromPreset(_In_ const eEncodePreset encodePreset) noexcept
+    {
+        EncodeOptions encodeOptions;
+        switch (encodePreset)
+        {
+        case eEncodePreset::Fast:
+            encodeOptions.mMethod = 0;
+            encodeOptions.mThreadLevel = 1;
+            break;
+        case eEncodePreset::Balanced:
+            break;
+        case eEncodePreset::Smallest:
+            // 팔레트 캔버스는 이미 무손실이므로 minimize_size/allow_mixed는 시간만 늘어남
+            encodeOptions.mMethod = 6;
+            break;
+        }
+
+        return encodeOptions;
+    }
+
+    Error EncodeOptions::ParsePreset(_In_ const std::wstring_view& name, _Out_ eEncodePreset& outEncodePreset)
+    {
+        outEncodePreset = eEncodePreset::Balanced;
+
+        if (name == L"fast")
+            outEncodePreset = eEncodePreset::Fast;
+        else if (name == L"balanced")
+            outEncodePreset = eEncodePreset::Balanced;
+        else if (name == L"smallest")
+            outEncodePreset = eEncodePreset::Smallest;
+        else
+            return MAKE_ERROR(eErrorCode::InvalidArguments);
+
+        return MAKE_ERROR(eErrorCode::Succeeded);
+    }
+
+    Error EncodeOptions::ParseOverrides(_In_ const std::wstring_view& overrides, _In_ const bool isPaletteCanvas,
+                                        _Inout_ EncodeOptions& encodeOptions)
+    {
+        // 하나라도 잘못되면 원래 설정을 유지하도록 복사본에 적용
+        EncodeOptions parsedOptions = encodeOptions;
+        bool hasLossyOverride = false; // 팔레트 무손실 인코딩에서 무시되는 key를 지정했는지
+
+        size_t itemBegin = 0;
+        while (itemBegin <= overrides.size())
+        {
+            size_t itemEnd = overrides.find(L',', itemBegin);
+            if (itemEnd == std::wstring_view::npos)
+                itemEnd = overrides.size();
+
+            const std::wstring_view item = overrides.substr(itemBegin, itemEnd - itemBegin);
+            itemBegin = itemEnd + 1;
+
+            const size_t separator = item.find(L'=');
+            if (separator == std::wstring_view::npos)
+                return MAKE_ERROR(eErrorCode::InvalidArguments);
+
+            const std::wstring_view key = item.substr(0, separator);
+            const std::wstring_view value = item.substr(separator + 1);
+
+            int parsedValue = 0;
+            bool isValid = false;
+            if (key == L"quality")
+            {
+                isValid = TryParseInt(value, 0, 100, parsedValue);
+                parsedOptions.mQuality = static_cast<float>(parsedValue);
+                hasLossyOverride = true;
+            }
+            else if (key == L"method")
+            {
+                isValid = TryParseInt(value, 0, 6, parsedValue);
+                parsedOptions.mMethod = parsedValue;
+            }
+            else if (key == L"lossless")
+            {
+                isValid = TryParseInt(value, 0, 1, parsedValue);
+                parsedOptions.mLossless = parsedValue != 0;
+                hasLossyOverride = true;
+            }
+            else if (key == L"near_lossless")
+            {
+                isValid = TryParseInt(value, 0, 100, parsedValue);
+                parsedOptions.mNearLossless = parsedValue;
+                hasLossyOverride = true;
+            }
+            else if (key == L"thread_level")
+            {
+                isValid = TryParseInt(value, 0, 1, parsedValue);
+                parsedOptions.mThreadLevel = parsedValue;
+            }
+            else if (key == L"exact")
+            {
+                isValid = TryParseInt(value, 0, 1, parsedValue);
+                parsedOptions.mExact = parsedValue != 0;
+            }
+            else if (key == L"kmin")
+            {
+                isValid = TryParseInt(value, 0, std::numeric_limits<int>::max(), parsedValue);
+                parsedOptions.mKeyframeMin = parsedValue;
+            }
+            else if (key == L"kmax")
+            {
+                isValid = TryParseInt(value, 0, std::numeric_limits<int>::max(), parsedValue);
+                parsedOptions.mKeyframeMax = parsedValue;
+            }
+            else if (key == L"minimize_size")
+            {
+                isValid = TryParseInt(value, 0, 1, parsedValue);
+                parsedOptions.mMinimizeSize = parsedValue != 0;
+            }
+            else if (key == L"allow_mixed")
+            {
+                isValid = TryParseInt(value, 0, 1, parsedValue);
+                parsedOptions.mAllowMixed = parsedValue != 0;
+            }
+            else if (key == L"palette")
+            {
+                isValid = TryParseInt(value, 0, 1, parsedValue);
+                parsedOptions.mPaletteLossless = parsedValue != 0;
+            }
+
+            if (isValid == false)
+                return MAKE_ERROR(eErrorCode::InvalidArguments);
+        }
+
+        // 팔레트 무손실 인코딩은 method만 사용하므로 조용히 무시하지 않고 거부 (key 순서와 관계없이 최종 palette 값 기준)
+        if (isPaletteCanvas && parsedOptions.mPaletteLossless && hasLossyOverride)
+            return MAKE_ERROR(eErrorCode::InvalidArguments);
+
+        encodeOptions = parsedOptions;
+        return MAKE_ERROR(eErrorCode::Succeeded);
+    }
+
+    void EncodeOptions::ApplyTo(_Inout_ WebPConfig& config) const noexcept
+    {
+        config.quality = mQuality;
+        config.method = mMethod;
+        config.lossless = mLossless ? 1 : 0;
+        config.near_lossless = mNearLossless;
+        config.thread_level = mThreadLevel;
+        config.exact = mExact ? 1 : 0;
+    }
+
+    void EncodeOptions::ApplyTo(_Inout_ WebPAnimEncoderOptions& animEncoderOptions) const noexcept
+    {
+        // kmax가 0이면 libwebp 기본값(키프레임 없음)을 유지
+        if (mKeyframeMax > 0)
+        {
+            animEncoderOptions.kmin = mKeyframeMin;
+            animEncoderOptions.kmax = mKeyframeMax;
+        }
+        animEncoderOptions.minimize_size = mMinimizeSize ? 1 : 0;
+        animEncoderOptions.allow_mixed = mAllowMixed ? 1 : 0;
+    }
+} // CoTigraphy
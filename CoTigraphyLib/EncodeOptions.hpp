@@ -0,0 +1,91 @@
+﻿// \file EncodeOptions.hpp
+// \last_updated 2026-10-16
+// \author Oh Sungsik <ohsungsik@outlook.com>
+// \copyright (C) 2025. Oh Sungsik. All rights reserved.
+
+#pragma once
+
+#include <string_view>
+
+#include <webp/encode.h>
+#include <webp/mux.h>
+
+#include "Error.hpp"
+
+namespace CoTigraphy
+{
+    /**
+     * @brief 인코딩 속도와 출력 크기의 균형을 정하는 미리 정의된 설정
+     */
+    enum class eEncodePreset
+    {
+        Fast, // method 0 + 인코더 내부 멀티스레드 (요청 즉시 렌더링용)
+        Balanced, // libwebp 기본값 + quality 90 (기본값)
+        Smallest, // method 6 (야간 배치용)
+    };
+
+    /**
+     * @brief FrameWriter가 사용하는 libwebp 인코딩 설정
+     * @details
+     * - 각 항목은 같은 이름의 WebPConfig/WebPAnimEncoderOptions 필드에 그대로 들어감
+     * - mKeyframeMin/mKeyframeMax/mMinimizeSize/mAllowMixed는 WebPAnimEncoder(WebPWriter)에만 적용
+     *   (WebPMuxWriter는 변경 영역을 직접 잘라 인코딩하므로 키프레임/프레임 비교가 없음)
+     * - mPaletteLossless는 팔레트 캔버스(ePixelFormat::Indexed8)를 받는 WebPWriter에만 적용
+     */
+    struct EncodeOptions
+    {
+        float mQuality = 90.0f; // quality (0 ~ 100)
+        int mMethod = 4; // method (0: 가장 빠름 ~ 6: 가장 작음)
+        bool mLossless = false; // lossless
+        int mNearLossless = 100; // near_lossless (0 ~ 100, 100: 끔, lossless일 때만 사용)
+        int mThreadLevel = 0; // thread_level (0 또는 1, 1이면 인코더 내부에서 스레드 사용)
+        bool mExact = false; // exact (투명 픽셀의 RGB 보존)
+        int mKeyframeMin = 0; // kmin (mKeyframeMax가 0이면 사용하지 않음)
+        int mKeyframeMax = 0; // kmax (0: 키프레임 없음, libwebp 기본값)
+        bool mMinimizeSize = false; // minimize_size (프레임마다 여러 방식으로 인코딩해 가장 작은 것을 선택)
+        bool mAllowMixed = false; // allow_mixed (프레임마다 손실/무손실 중 작은 쪽 선택)
+        bool mPaletteLossless = true; // palette (팔레트 캔버스는 mLossless/mQuality와 관계없이 mMethod에 맞는 VP8L 무손실 설정으로 인코딩)
+
+        /**
+         * @brief 미리 정의된 설정을 반환
+         * @param encodePreset 설정 이름
+         */
+        [[nodiscard]] static EncodeOptions FromPreset(_In_ const eEncodePreset encodePreset) noexcept;
+
+        /**
+         * @brief 설정 이름을 파싱
+         * @param name "fast", "balanced" 또는 "smallest"
+         * @param outEncodePreset 파싱한 설정
+         * @return 성공 시 Succeeded, 모르는 이름이면 InvalidArguments
+         */
+        [[nodiscard]] static Error ParsePreset(_In_ const std::wstring_view& name,
+                                               _Out_ eEncodePreset& outEncodePreset);
+
+        /**
+         * @brief "key=value,key=value" 형식의 개별 설정으로 값을 덮어씀
+         * @param overrides 예: "method=0,thread_level=1"
+         * @param isPaletteCanvas 팔레트 캔버스(WebPWriter)에 적용할 설정이면 true
+         * @param encodeOptions 덮어쓸 설정 (실패하면 바뀌지 않음)
+         * @return 성공 시 Succeeded, 모르는 key나 범위를 벗어난 값이 있으면 InvalidArguments
+         * @details
+         * - key: quality, method, lossless, near_lossless, thread_level, exact, kmin, kmax, minimize_size, allow_mixed,
+         *   palette
+         * - 팔레트 무손실 인코딩(isPaletteCanvas이고 palette=1)에서는 quality/lossless/near_lossless가 무시되므로
+         *   이 key를 지정하면 InvalidArguments (palette=0과 함께 지정해야 함)
+         */
+        [[nodiscard]] static Error ParseOverrides(_In_ const std::wstring_view& overrides, _In_ bool isPaletteCanvas,
+                                                  _Inout_ EncodeOptions& encodeOptions);
+
+        /**
+         * @brief 프레임 인코딩 설정에 적용
+         * @param config WebPConfigInit()으로 초기화된 설정
+         */
+        void ApplyTo(_Inout_ WebPConfig& config) const noexcept;
+
+        /**
+         * @brief 애니메이션 인코더 설정에 적용
+         * @param animEncoderOptions WebPAnimEncoderOptionsInit()으로 초기화된 설정
+         */
+        void ApplyTo(_Inout_ WebPAnimEncoderOptions& animEncoderOptions) const noexcept;
+    };
+} // CoTigraphy
@@ -1,5 +1,5 @@
 ﻿// \file ErrorCode.hpp
-// \last_updated 2025-06-14
+// \last_updated 2026-10-16
 // \author Oh Sungsik <ohsungsik@outlook.com>
 // \copyright (C) 2025. Oh Sungsik. All rights reserved.
 
@@ -159,8 +159,14 @@ namespace CoTigraphy
         CommandLineArgumentNotFound,                                // 미정의 명령줄 인자가 들어왔을 때
 
         MissingFileName,                                            // 파일 명이 주어지지 않음
-        InvalidFileExtension,                                       // 유효하지 않은 파일 확장자 (.webp만 지원)
+        InvalidFileExtension,                                       // 유효하지 않은 파일 확장자 (.webp, .svg만 지원)
         FileIOFailure,                                              // File IO 실패
+        InvalidUsersFile,                                           // 배치 렌더링 목록 파일 형식 오류 또는 빈 목록
+        InvalidSimulationLog,                                       // 시뮬레이션 기록 파일 형식 오류
+        EncodingFailure,                                            // 애니메이션 인코딩/조립 실패
+        NetworkFailure,                                             // GitHub API 요청 실패 (연결 실패, HTTP 200 이외의 응답)
+        InvalidContributionData,                                    // GitHub API 응답 형식 오류 (없는 사용자, Contribution 없음 등)
+        PaletteOverflow,                                            // Indexed8 캔버스에 필요한 색상이 팔레트 256색을 넘음
 
     };
 
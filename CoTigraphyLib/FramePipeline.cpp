@@ -0,0 +1,134 @@
+﻿// \file FramePipeline.cpp
+// \last_updated 2026-10-16
+// \author Oh Sungsik <ohsungsik@outlook.com>
+// \copyright (C) 2025. Oh Sungsik. All rights reserved.
+
+#include "pch.hpp"
+#include "FramePipeline.hpp"
+
+namespace CoTigraphy
+{
+    FramePipeline::FramePipeline() noexcept
+    = default;
+
+    FramePipeline::~FramePipeline()
+    {
+        for (uint8_t* buffer : mBuffers)
+            _aligned_free(buffer);
+        mBuffers.clear();
+    }
+
+    void FramePipeline::Create(_In_ const size_t frameSize, _In_ const size_t frameCount)
+    {
+        PRECONDITION(frameSize != 0);
+        PRECONDITION(frameCount != 0);
+
+        const std::lock_guard<std::mutex> lock(mMutex);
+
+        mFrameSize = frameSize;
+
+        // 이전 작업의 버퍼가 작으면 모두 다시 할당
+        if (mFrameSize > mFrameCapacity)
+        {
+            for (uint8_t* buffer : mBuffers)
+                _aligned_free(buffer);
+            mBuffers.clear();
+            mFrameCapacity = mFrameSize;
+        }
+
+        while (mBuffers.size() < frameCount)
+        {
+            uint8_t* buffer = static_cast<uint8_t*>(_aligned_malloc(mFrameCapacity, mAlignment));
+            POSTCONDITION(buffer != nullptr);
+            mBuffers.push_back(buffer);
+        }
+
+        mFreeFrames.clear();
+        mReadyFrames.clear();
+        for (size_t i = 0; i < frameCount; ++i)
+        {
+            PipelineFrame frame;
+            frame.mBuffer = mBuffers[i];
+            frame.mBufferIndex = i;
+            mFreeFrames.push_back(frame);
+        }
+
+        // 이전 작업의 내용이 남은 버퍼도 처음 쓰는 버퍼로 취급
+        mStaleRects.assign(frameCount, mWholeRect);
+
+        mClosed = false;
+    }
+
+    PipelineFrame FramePipeline::AcquireFreeFrame()
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+        PRECONDITION(mClosed == false);
+
+        mFreeCondition.wait(lock, [this] { return mFreeFrames.empty() == false; });
+
+        PipelineFrame frame = mFreeFrames.front();
+        mFreeFrames.pop_front();
+        frame.mStaleRect = mStaleRects[frame.mBufferIndex];
+
+        return frame;
+    }
+
+    void FramePipeline::PushFrame(_In_ const PipelineFrame& frame)
+    {
+        PRECONDITION(frame.mBuffer != nullptr);
+
+        {
+            const std::lock_guard<std::mutex> lock(mMutex);
+            PRECONDITION(mClosed == false);
+            mReadyFrames.push_back(frame);
+
+            // 다른 버퍼는 이 프레임의 변경 영역만큼 뒤처짐
+            for (size_t i = 0; i < mStaleRects.size(); ++i)
+            {
+                if (i == frame.mBufferIndex)
+                    SetRectEmpty(&mStaleRects[i]);
+                else
+                    UnionRect(&mStaleRects[i], &mStaleRects[i], &frame.mDirtyRect);
+            }
+        }
+
+        mReadyCondition.notify_one();
+    }
+
+    void FramePipeline::Close()
+    {
+        {
+            const std::lock_guard<std::mutex> lock(mMutex);
+            mClosed = true;
+        }
+
+        mReadyCondition.notify_all();
+    }
+
+    bool FramePipeline::PopFrame(_Out_ PipelineFrame& outFrame)
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+
+        mReadyCondition.wait(lock, [this] { return mReadyFrames.empty() == false || mClosed; });
+
+        if (mReadyFrames.empty())
+            return false; // Close() 이후 남은 프레임 없음
+
+        outFrame = mReadyFrames.front();
+        mReadyFrames.pop_front();
+
+        return true;
+    }
+
+    void FramePipeline::ReleaseFrame(_In_ const PipelineFrame& frame)
+    {
+        PRECONDITION(frame.mBuffer != nullptr);
+
+        {
+            const std::lock_guard<std::mutex> lock(mMutex);
+            mFreeFrames.push_back(frame);
+        }
+
+        mFreeCondition.notify_one();
+    }
+} // CoTigraphy
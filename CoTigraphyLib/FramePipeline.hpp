@@ -0,0 +1,119 @@
+﻿// \file FramePipeline.hpp
+// \last_updated 2026-10-16
+// \author Oh Sungsik <ohsungsik@outlook.com>
+// \copyright (C) 2025. Oh Sungsik. All rights reserved.
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <limits>
+#include <mutex>
+#include <vector>
+
+namespace CoTigraphy
+{
+    /**
+     * @brief 파이프라인 단계 사이에서 전달되는 프레임 하나
+     */
+    struct PipelineFrame
+    {
+        uint8_t* mBuffer = nullptr; // 프레임 픽셀 버퍼 (FramePipeline 소유)
+        size_t mBufferIndex = 0; // mBuffer의 FramePipeline 내부 번호
+        RECT mStaleRect{}; // 이 버퍼에 마지막으로 채운 프레임 이후 다른 프레임들의 mDirtyRect 합 (AcquireFreeFrame이 설정, 처음 쓰는 버퍼는 FramePipeline::mWholeRect)
+        RECT mDirtyRect{}; // 직전 프레임 대비 바뀐 영역 (GridCanvas::GetDirtyRect, 합쳐진 이벤트의 영역 포함)
+        int mDurationMs = 0; // 프레임 표시 시간 (FrameTimeline::Build)
+    };
+
+    /**
+     * @brief 렌더링 단계와 인코딩 단계를 잇는 고정 크기 프레임 큐
+     * @details
+     * - Create()에서 지정한 개수만큼 프레임 버퍼를 미리 할당하고, 인코딩이 끝난 버퍼를 다시 렌더링 단계에 돌려주어 재사용
+     * - 모든 버퍼가 사용 중이면 AcquireFreeFrame()이 대기하므로 메모리 사용량은 Create() 시점에 고정됨
+     * - 생산자(시뮬레이션/래스터화) 스레드 하나, 소비자(인코딩) 스레드 하나를 가정
+     * - 버퍼는 마지막으로 채운 프레임을 그대로 갖고 있으므로 생산자는 mStaleRect와 새 mDirtyRect가 덮는 부분만 다시 채우면 됨
+     *
+     * 생산자: AcquireFreeFrame -> 버퍼 채우기 -> PushFrame 반복 -> Close
+     * 소비자: PopFrame -> 인코딩 -> ReleaseFrame 반복 (PopFrame이 false를 반환하면 종료)
+     */
+    class FramePipeline final
+    {
+    public:
+        explicit FramePipeline() noexcept;
+        FramePipeline(const FramePipeline& other) = delete;
+        FramePipeline(FramePipeline&& other) = delete;
+
+        FramePipeline& operator=(const FramePipeline& rhs) = delete;
+        FramePipeline& operator=(FramePipeline&& rhs) = delete;
+
+        /**
+         * @brief 소멸자 (프레임 버퍼 해제)
+         */
+        ~FramePipeline();
+
+        /**
+         * @brief 프레임 버퍼를 준비하고 큐를 초기 상태로 되돌림
+         * @param frameSize 프레임 하나의 바이트 크기
+         * @param frameCount 미리 할당할 프레임 버퍼 수 (큐의 최대 길이)
+         * @pre frameSize > 0 && frameCount > 0
+         * @pre 이전 작업의 생산자/소비자 스레드가 모두 종료된 상태
+         * @details
+         * - 이전 작업의 버퍼가 충분히 크면 재할당하지 않음
+         */
+        void Create(_In_ const size_t frameSize, _In_ const size_t frameCount);
+
+        /**
+         * @brief 렌더링에 사용할 빈 프레임을 가져옴, 빈 프레임이 없으면 소비자가 반환할 때까지 대기
+         * @return 빈 프레임 (mStaleRect: 이 버퍼 이후 PushFrame()된 프레임들의 변경 영역 합)
+         */
+        [[nodiscard]] PipelineFrame AcquireFreeFrame();
+
+        /**
+         * @brief 렌더링이 끝난 프레임을 인코딩 큐에 추가
+         * @param frame AcquireFreeFrame()으로 가져온 프레임
+         * @details
+         * - frame.mDirtyRect를 다른 모든 버퍼의 mStaleRect에 더하고, 이 버퍼의 mStaleRect는 비움
+         */
+        void PushFrame(_In_ const PipelineFrame& frame);
+
+        /**
+         * @brief 더 이상 프레임을 추가하지 않음을 알림
+         * @details
+         * - 큐에 남은 프레임은 소비자가 모두 가져간 뒤 PopFrame()이 false를 반환
+         */
+        void Close();
+
+        /**
+         * @brief 인코딩할 프레임을 가져옴, 큐가 비어 있으면 대기
+         * @param[out] outFrame 가져온 프레임
+         * @return 프레임을 가져오면 true, Close() 이후 큐가 비었으면 false
+         */
+        [[nodiscard]] bool PopFrame(_Out_ PipelineFrame& outFrame);
+
+        /**
+         * @brief 인코딩이 끝난 프레임을 빈 프레임 목록에 반환
+         * @param frame PopFrame()으로 가져온 프레임
+         */
+        void ReleaseFrame(_In_ const PipelineFrame& frame);
+
+        /**
+         * @brief 아직 한 번도 채우지 않은 버퍼의 mStaleRect (모든 캔버스를 덮는 영역)
+         */
+        static constexpr RECT mWholeRect = {0, 0, std::numeric_limits<LONG>::max(), std::numeric_limits<LONG>::max()};
+
+    private:
+        const size_t mAlignment = 32; // 프레임 버퍼 정렬 (GridCanvas와 동일)
+
+        size_t mFrameSize = 0; // 현재 프레임 크기
+        size_t mFrameCapacity = 0; // 할당된 프레임 버퍼 크기 (재사용 판단용)
+        std::vector<uint8_t*> mBuffers; // 할당된 모든 프레임 버퍼
+        std::vector<RECT> mStaleRects; // 버퍼별 마지막 PushFrame() 이후 다른 프레임들의 변경 영역 합 (mBufferIndex 순서)
+
+        std::mutex mMutex;
+        std::condition_variable mFreeCondition; // 빈 프레임 반환 알림
+        std::condition_variable mReadyCondition; // 인코딩할 프레임 추가/종료 알림
+        std::deque<PipelineFrame> mFreeFrames; // 렌더링 단계가 사용할 수 있는 프레임
+        std::deque<PipelineFrame> mReadyFrames; // 인코딩을 기다리는 프레임 (렌더링 순서 유지)
+        bool mClosed = false; // 생산자 종료 여부
+    };
+} // CoTigraphy
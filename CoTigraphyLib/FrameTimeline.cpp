@@ -0,0 +1,47 @@
+﻿// \file FrameTimeline.cpp
+// \last_updated 2026-10-16
+// \author Oh Sungsik <ohsungsik@outlook.com>
+// \copyright (C) 2025. Oh Sungsik. All rights reserved.
+
+#include "pch.hpp"
+#include "FrameTimeline.hpp"
+
+namespace CoTigraphy
+{
+    void FrameTimeline::Build(_In_ const std::vector<SimulationEvent>& events, _In_ const eTimeline timeline,
+                              _Out_ std::vector<int>& outFrameDurations)
+    {
+        outFrameDurations.assign(events.size(), 0);
+        if (events.empty())
+            return;
+
+        if (timeline == eTimeline::Uniform)
+        {
+            std::fill(outFrameDurations.begin(), outFrameDurations.end(), mUniformFrameMs);
+            return;
+        }
+
+        ASSERT(timeline == eTimeline::Dynamic);
+
+        // 현재 프레임을 시작한 이벤트 (이어지는 빈 셀 이동은 이 프레임의 시간에 더해짐)
+        size_t frameIndex = 0;
+        for (size_t eventIndex = 0; eventIndex < events.size(); ++eventIndex)
+        {
+            const SimulationEvent& simulationEvent = events[eventIndex];
+            const bool isEating = simulationEvent.HasFlag(eSimulationEventFlag::AteContribution);
+            const int eventMs = isEating ? mEatFrameMs : mTravelStepMs;
+
+            // 빈 셀 이동은 직전 프레임이 충분히 보이지 않았으면 그 프레임에 합침 (여러 칸을 한 번에 이동)
+            const bool isMergeable = eventIndex > 0 && isEating == false &&
+                events[frameIndex].HasFlag(eSimulationEventFlag::AteContribution) == false &&
+                outFrameDurations[frameIndex] < mMinTravelFrameMs;
+
+            if (isMergeable == false)
+                frameIndex = eventIndex;
+
+            outFrameDurations[frameIndex] += eventMs;
+        }
+
+        outFrameDurations[frameIndex] += mEndHoldMs;
+    }
+} // CoTigraphy
@@ -0,0 +1,55 @@
+﻿// \file FrameTimeline.hpp
+// \last_updated 2026-10-16
+// \author Oh Sungsik <ohsungsik@outlook.com>
+// \copyright (C) 2025. Oh Sungsik. All rights reserved.
+
+#pragma once
+
+#include <vector>
+
+#include "SimulationLog.hpp"
+
+namespace CoTigraphy
+{
+    /**
+     * @brief 시뮬레이션 이벤트를 애니메이션 시간으로 옮기는 방식
+     */
+    enum class eTimeline
+    {
+        Uniform, // 이벤트마다 프레임 1개, 모두 같은 시간 (기본값)
+        Dynamic, // 먹을 때 멈추고, 빈 셀 이동은 빠르게 여러 칸씩, 끝에서 정지 화면 유지
+    };
+
+    /**
+     * @brief 이벤트별 프레임 표시 시간을 계산하는 애니메이션 시계
+     * @details
+     * - 이벤트마다 진행 시간을 정하고, 이어지는 빈 셀 이동은 mMinTravelFrameMs가 될 때까지 한 프레임으로 합침
+     * - 합쳐진 이벤트는 프레임을 만들지 않으므로 (시간 0) 인코딩 횟수와 출력 크기가 줄어듦
+     * - 렌더링 경로(단일 파이프라인, ChunkedEncoder, SvgWriter)와 무관하게 같은 규칙을 사용하므로 재생 시간이 같음
+     *   (ChunkedEncoder는 합치는 규칙을 바꾸지 않고 프레임이 시작하는 이벤트에서 chunk를 나눔)
+     */
+    class FrameTimeline final
+    {
+    public:
+        FrameTimeline() = delete;
+
+        /**
+         * @brief 이벤트마다 프레임 표시 시간을 계산
+         * @param events 프레임 순서의 시뮬레이션 이벤트
+         * @param timeline 시간 계산 방식
+         * @param[out] outFrameDurations 이벤트마다 그 이벤트로 시작하는 프레임의 표시 시간 (ms, 0: 앞 프레임에 합쳐짐)
+         * @details
+         * - outFrameDurations의 합이 애니메이션 전체 길이
+         * - 첫 이벤트는 항상 프레임을 만듦
+         */
+        static void Build(_In_ const std::vector<SimulationEvent>& events, _In_ const eTimeline timeline,
+                          _Out_ std::vector<int>& outFrameDurations);
+
+    public:
+        static constexpr int mUniformFrameMs = 80; // Uniform: 이벤트 하나의 시간
+        static constexpr int mEatFrameMs = 160; // Dynamic: Contribution을 먹은 이벤트의 시간 (먹는 동안 멈춤)
+        static constexpr int mTravelStepMs = 40; // Dynamic: 빈 셀을 지나는 이벤트 하나의 시간
+        static constexpr int mMinTravelFrameMs = 80; // Dynamic: 빈 셀 이동 프레임의 최소 표시 시간
+        static constexpr int mEndHoldMs = 2000; // Dynamic: 마지막 프레임을 추가로 보여주는 시간
+    };
+} // CoTigraphy
@@ -0,0 +1,129 @@
+﻿// \file FrameWriter.cpp
+// \last_updated 2026-10-16
+// \author Oh Sungsik <ohsungsik@outlook.com>
+// \copyright (C) 2025. Oh Sungsik. All rights reserved.
+
+#include "pch.hpp"
+#include "FrameWriter.hpp"
+
+#include <filesystem>
+
+#include "WebPMuxWriter.hpp"
+#include "WebPWriter.hpp"
+
+namespace CoTigraphy
+{
+    std::unique_ptr<FrameWriter> FrameWriter::Create(_In_ const eFrameWriterType frameWriterType)
+    {
+        switch (frameWriterType)
+        {
+        case eFrameWriterType::AnimEncoder:
+            return std::make_unique<WebPWriter>();
+        case eFrameWriterType::SubRectMux:
+            return std::make_unique<WebPMuxWriter>();
+        }
+
+        ASSERT(false);
+        return nullptr;
+    }
+
+    FrameWriter::FrameWriter() noexcept
+    = default;
+
+    FrameWriter::~FrameWriter()
+    = default;
+
+    Error FrameWriter::SaveToFile(_In_ const std::wstring& fileName)
+    {
+        RETURN_IF_FAILED(ValidateFileName(fileName, GetFileExtension()));
+
+        std::vector<uint8_t> data;
+        RETURN_IF_FAILED(Assemble(data));
+
+        return WriteToFile(fileName, data.data(), data.size());
+    }
+
+    Error FrameWriter::ValidateFileName(_In_ const std::wstring& fileName, _In_ const wchar_t* const extension)
+    {
+        PRECONDITION(fileName.empty() == false);
+        PRECONDITION(extension != nullptr);
+
+        const std::filesystem::path path(fileName);
+        // 확장자가 유효한지 확인, 대소문자 무시
+        if (_wcsicmp(path.extension().c_str(), extension) != 0)
+        {
+            return MAKE_ERROR(eErrorCode::InvalidFileExtension);
+        }
+
+        // 파일 이름 (확장자 제외)이 비었는지 확인
+        if (path.stem().empty())
+        {
+            return MAKE_ERROR(eErrorCode::MissingFileName);
+        }
+
+        return MAKE_ERROR(eErrorCode::Succeeded);
+    }
+
+    Error FrameWriter::WriteToFile(_In_ const std::wstring& fileName, _In_ const uint8_t* const data,
+                                   _In_ const size_t size)
+    {
+        // 데이터가 유효한지 확인
+        PRECONDITION(data != nullptr);
+        PRECONDITION(size > 0);
+
+        // 파일로 저장
+        const HANDLE hFile = CreateFileW(
+            fileName.c_str(), // 파일 이름
+            GENERIC_WRITE, // 쓰기 권한
+            0, // 공유 모드 없음
+            nullptr, // 보안 속성
+            CREATE_ALWAYS, // 항상 새로 생성
+            FILE_ATTRIBUTE_NORMAL, // 일반 파일 속성
+            nullptr // 템플릿 파일 없음
+        );
+
+        // 파일 생성 성공 여부 확인
+        if (hFile == INVALID_HANDLE_VALUE)
+        {
+            return MAKE_ERROR_FROM_LAST_WIN32_ERROR();
+        }
+
+        // 파일에 데이터 쓰기
+        size_t totalWritten = 0;
+
+        // 네트워크 드라이브 디스크에서 간혹 한번에 안써지는 경우가 발생..
+        // 따라서 모든 데이터를 다 쓸떄 까지 반복하여 쓰기 시도
+        while (totalWritten < size)
+        {
+            DWORD bytesWritten = 0;
+
+            // 한 번에 WriteFile이 처리 가능한 최대 크기 계산
+            const DWORD chunkSize = static_cast<DWORD>(
+                std::min<size_t>(size - totalWritten, static_cast<size_t>(MAXDWORD))
+            );
+
+            const BOOL writeResult = WriteFile(
+                hFile,
+                data + totalWritten,
+                chunkSize,
+                &bytesWritten,
+                nullptr
+            );
+
+            if (!writeResult)
+            {
+                // 실패 처리
+                CloseHandle(hFile);
+                return MAKE_ERROR(eErrorCode::FileIOFailure);
+            }
+
+            totalWritten += bytesWritten;
+        }
+
+        // 파일 핸들 정리
+        const BOOL closeResult = CloseHandle(hFile);
+        ASSERT(closeResult != FALSE);
+
+        return MAKE_ERROR(eErrorCode::Succeeded);
+    }
+} // CoTigraphy
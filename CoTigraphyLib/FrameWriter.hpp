@@ -0,0 +1,133 @@
+﻿// \file FrameWriter.hpp
+// \last_updated 2026-10-16
+// \author Oh Sungsik <ohsungsik@outlook.com>
+// \copyright (C) 2025. Oh Sungsik. All rights reserved.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "EncodeOptions.hpp"
+#include "PixelKernels.hpp"
+
+namespace CoTigraphy
+{
+    /**
+     * @brief 애니메이션 출력 방식
+     */
+    enum class eFrameWriterType
+    {
+        AnimEncoder, // WebPAnimEncoder가 프레임 간 차이를 직접 계산 (WebPWriter)
+        SubRectMux, // 변경 영역만 WebPEncode로 인코딩해 WebPMux로 조립 (WebPMuxWriter)
+    };
+
+    /**
+     * @brief 렌더링된 프레임을 받아 애니메이션 파일로 저장하는 writer의 공통 인터페이스
+     * @details
+     * - Initialize -> AddFrame 반복 -> SaveToFile(또는 Assemble) 순으로 사용
+     * - SaveToFile() 이후 다시 Initialize()를 호출해 재사용 가능
+     * - 구현 클래스는 Assemble()과 GetFileExtension()만 제공하고, 파일 저장은 공통 SaveToFile()이 담당
+     */
+    class FrameWriter
+    {
+    public:
+        /**
+         * @brief 지정된 방식의 writer를 생성
+         * @param frameWriterType 출력 방식
+         * @return 생성된 writer
+         */
+        [[nodiscard]] static std::unique_ptr<FrameWriter> Create(_In_ const eFrameWriterType frameWriterType);
+
+    public:
+        FrameWriter(const FrameWriter& other) = delete;
+        FrameWriter(FrameWriter&& other) = delete;
+
+        FrameWriter& operator=(const FrameWriter& rhs) = delete;
+        FrameWriter& operator=(FrameWriter&& rhs) = delete;
+
+        virtual ~FrameWriter();
+
+        /**
+         * @brief 새 애니메이션을 시작
+         * @param width 출력 애니메이션 가로 해상도 (픽셀)
+         * @param height 출력 애니메이션 세로 해상도 (픽셀)
+         * @return 성공 시 Succeeded, libwebp 인코더를 만들 수 없으면 EncodingFailure
+         * @pre width > 0 && height > 0
+         */
+        [[nodiscard]] virtual Error Initialize(_In_ const size_t& width, _In_ const size_t& height) = 0;
+
+        /**
+         * @brief 프레임을 애니메이션에 추가
+         * @param buffer GetPixelFormat() 형식의 캔버스 전체 픽셀 데이터
+         * @details
+         * - buffer는 변환/복사 없이 WebPPicture로 인코더에 전달되며, 호출이 끝날 때까지 유효해야 함
+         * @param dirtyRect 직전 프레임 대비 바뀐 영역 (첫 프레임은 캔버스 전체)
+         * @param durationMs 이 프레임의 표시 시간 (ms, FrameTimeline::Build())
+         * @return 성공 여부 (true = 성공, false = 실패)
+         * @pre Initialize() 이후에만 호출 가능
+         * @pre durationMs > 0
+         */
+        virtual bool AddFrame(_In_ const uint8_t* const buffer, _In_ const RECT& dirtyRect, _In_ const int durationMs) = 0;
+
+        /**
+         * @brief 지금까지 추가된 프레임을 애니메이션 파일 내용으로 조립
+         * @param[out] outData 완성된 파일 내용
+         * @return 성공 시 Succeeded, 실패 시 EncodingFailure
+         * @pre 최소 1개의 프레임이 AddFrame()을 통해 등록되어 있어야 함
+         * @details
+         * - 한 애니메이션에 대해 한 번만 호출 (다시 사용하려면 Initialize() 호출)
+         */
+        [[nodiscard]] virtual Error Assemble(_Out_ std::vector<uint8_t>& outData) = 0;
+
+        /**
+         * @brief AddFrame()이 받는 픽셀 형식을 반환 (GridCanvasContext::mPixelFormat으로 사용)
+         */
+        [[nodiscard]] virtual ePixelFormat GetPixelFormat() const noexcept = 0;
+
+        /**
+         * @brief 출력 파일에 허용하는 확장자를 반환 (예: L".webp")
+         */
+        [[nodiscard]] virtual const wchar_t* GetFileExtension() const noexcept = 0;
+
+        /**
+         * @brief 다음 Initialize()부터 사용할 인코딩 설정을 지정
+         * @param encodeOptions libwebp 인코딩 설정 (기본값: EncodeOptions{}, eEncodePreset::Balanced)
+         */
+        void SetEncodeOptions(_In_ const EncodeOptions& encodeOptions) noexcept { mEncodeOptions = encodeOptions; }
+
+        /**
+         * @brief 지금까지 추가된 프레임을 애니메이션 파일로 저장
+         * @param fileName 저장할 파일 경로 (GetFileExtension() 확장자만 허용)
+         * @return 성공 시 Succeeded, 실패 시 에러 코드
+         * @pre 최소 1개의 프레임이 AddFrame()을 통해 등록되어 있어야 함
+         */
+        [[nodiscard]] Error SaveToFile(_In_ const std::wstring& fileName);
+
+        /**
+         * @brief 출력 파일 이름이 유효한지 검사 (래스터가 아닌 출력(SvgWriter)도 사용)
+         * @param fileName 저장할 파일 경로
+         * @param extension 허용하는 확장자 (예: L".webp", 대소문자 무시)
+         * @return 유효하면 Succeeded, 아니면 InvalidFileExtension 또는 MissingFileName
+         */
+        [[nodiscard]] static Error ValidateFileName(_In_ const std::wstring& fileName,
+                                                    _In_ const wchar_t* const extension);
+
+        /**
+         * @brief 메모리의 데이터를 파일로 저장
+         * @param fileName 저장할 파일 경로 (기존 파일은 덮어씀)
+         * @param data 저장할 데이터
+         * @param size 데이터 크기 (바이트)
+         * @return 성공 시 Succeeded, 실패 시 에러 코드
+         */
+        [[nodiscard]] static Error WriteToFile(_In_ const std::wstring& fileName, _In_ const uint8_t* const data,
+                                               _In_ const size_t size);
+
+    protected:
+        explicit FrameWriter() noexcept;
+
+    protected:
+        EncodeOptions mEncodeOptions; // Initialize()에서 libwebp 설정에 적용할 인코딩 설정
+    };
+} // CoTigraphy
@@ -1,5 +1,5 @@
 ﻿// \file GitHubContributionCalendarClient.cpp
-// \last_updated 2025-06-14
+// \last_updated 2026-10-16
 // \author Oh Sungsik <ohsungsik@outlook.com>
 // \copyright (C) 2025. Oh Sungsik. All rights reserved.
 
@@ -35,11 +35,19 @@ namespace CoTigraphy
     GitHubContributionCalendarClient::~GitHubContributionCalendarClient()
     = default;
 
-    void GitHubContributionCalendarClient::Initialize()
+    void GitHubContributionCalendarClient::GlobalInitialize()
     {
         const CURLcode code = curl_global_init(CURL_GLOBAL_DEFAULT);
         ASSERT(code == CURLE_OK);
+    }
+
+    void GitHubContributionCalendarClient::GlobalUninitialize()
+    {
+        curl_global_cleanup();
+    }
 
+    void GitHubContributionCalendarClient::Initialize()
+    {
         mCurl = curl_easy_init();
         ASSERT(mCurl != nullptr);
 
@@ -64,8 +72,6 @@ namespace CoTigraphy
         curl_easy_cleanup(mCurl);
         mCurl = nullptr;
 
-        curl_global_cleanup();
-
         POSTCONDITION(mHeaders == nullptr);
         POSTCONDITION(mCurl == nullptr);
     }
@@ -87,17 +93,20 @@ namespace CoTigraphy
      * @brief GitHub의 기여 캘린더 데이터를 요청하고 파싱하여 GridData로 반환
      * @param userName GitHub 사용자 로그인 이름
      * @param fields GraphQL 요청 시 포함할 필드 목록 (예: "date contributionCount color")
-     * @return GridData 파싱된 기여 데이터
-     * @contract strong 모든 요청 실패 시 ASSERT 종료
+     * @param outGridData 파싱된 기여 데이터
+     * @return 성공 시 Succeeded, 요청 실패 시 NetworkFailure, 응답 형식 오류 시 InvalidContributionData
      * @pre mHeaders != nullptr (SetAccessToken 이후 호출해야 함)
-     * @post GridData 내부에 기여 데이터가 2차원 벡터로 채워짐
+     * @post 성공 시 outGridData 내부에 기여 데이터가 2차원 벡터로 채워짐
      * @details
      * - GraphQL API를 통해 JSON 형태로 기여 정보 요청
      * - 응답 결과는 Parse() 함수를 통해 파싱됨
      */
-    GridData GitHubContributionCalendarClient::FetchContributionInfo(_In_ const std::wstring& userName,
-                                                                     _In_ const std::wstring& fields) const
+    Error GitHubContributionCalendarClient::FetchContributionInfo(_In_ const std::wstring& userName,
+                                                                  _In_ const std::wstring& fields,
+                                                                  _Out_ GridData& outGridData) const
     {
+        outGridData = GridData{};
+
         PRECONDITION(mCurl != nullptr); // Initialize()를 먼저 호출해야 함
         PRECONDITION(mHeaders != nullptr); // SetAccessToken()을 먼저 호출해야 함
 
@@ -125,12 +134,19 @@ namespace CoTigraphy
         curl_easy_setopt(mCurl, CURLOPT_FRESH_CONNECT, 1L); // connection pool에서 즉시 종료
         curl_easy_setopt(mCurl, CURLOPT_SSL_SESSIONID_CACHE, 0L); // Schannel 사용 시 강제 cleanup
 
+        // 네트워크 오류, 잘못된 token 등은 이 사용자만 실패로 처리
         const CURLcode res = curl_easy_perform(mCurl);
-        ASSERT(res == CURLE_OK);
+        if (res != CURLE_OK)
+            return MAKE_ERROR(eErrorCode::NetworkFailure);
+
+        long responseCode = 0;
+        curl_easy_getinfo(mCurl, CURLINFO_RESPONSE_CODE, &responseCode);
+        if (responseCode != 200)
+            return MAKE_ERROR(eErrorCode::NetworkFailure);
 
         const std::string responseStr(responseBuffer.data());
 
-        return Parse(responseStr);
+        return Parse(responseStr, outGridData);
     }
 
     // https://docs.github.com/en/graphql/reference/objects#contributionscollection
@@ -199,17 +215,24 @@ namespace CoTigraphy
         return ret;
     }
 
-    GridData GitHubContributionCalendarClient::Parse(_In_ const std::string& response) const
+    Error GitHubContributionCalendarClient::Parse(_In_ const std::string& response, _Out_ GridData& outGridData) const
     {
-        PRECONDITION(response.empty() == false);
+        outGridData = GridData{};
 
         GridData gridData;
 
-        nlohmann::json root = nlohmann::json::parse(response, nullptr, false);
-        ASSERT(root.contains("data"));
+        const nlohmann::json root = nlohmann::json::parse(response, nullptr, false);
+        if (root.is_discarded())
+            return MAKE_ERROR(eErrorCode::InvalidContributionData);
 
-        const auto& weeks = root["data"]["user"]["contributionsCollection"]["contributionCalendar"]["weeks"];
-        ASSERT(weeks.is_array());
+        // 없는 사용자는 "user": null, 오류 응답은 "data"가 없음
+        const nlohmann::json::json_pointer weeksPointer("/data/user/contributionsCollection/contributionCalendar/weeks");
+        if (root.contains(weeksPointer) == false)
+            return MAKE_ERROR(eErrorCode::InvalidContributionData);
+
+        const auto& weeks = root.at(weeksPointer);
+        if (weeks.is_array() == false || weeks.empty())
+            return MAKE_ERROR(eErrorCode::InvalidContributionData);
 
         gridData.mWeekCount = weeks.size();
 
@@ -218,8 +241,12 @@ namespace CoTigraphy
 
         for (const auto& week : weeks)
         {
-            const auto& days = week["contributionDays"];
-            ASSERT(days.is_array());
+            if (week.is_object() == false || week.contains("contributionDays") == false)
+                return MAKE_ERROR(eErrorCode::InvalidContributionData);
+
+            const auto& days = week.at("contributionDays");
+            if (days.is_array() == false || days.empty())
+                return MAKE_ERROR(eErrorCode::InvalidContributionData);
 
             const size_t rowCount = days.size();
             if (gridData.mDayCount != 0)
@@ -227,7 +254,8 @@ namespace CoTigraphy
                 // 오늘이 수요일인 경우
                 // 일, 월, 화, 수 까지 rowCount가 4가 될 수 있다.
                 // 따라서 작거나 같은경우까지 혀용한다.
-                ASSERT(rowCount <= gridData.mDayCount);
+                if (rowCount > gridData.mDayCount)
+                    return MAKE_ERROR(eErrorCode::InvalidContributionData);
             }
 
             gridData.mDayCount = rowCount;
@@ -236,10 +264,14 @@ namespace CoTigraphy
 
             for (const auto& day : days)
             {
+                if (day.is_object() == false)
+                    return MAKE_ERROR(eErrorCode::InvalidContributionData);
+
                 GridCell cell;
-                cell.mCount = day.value("contributionCount", 0);
+                cell.mCount = day.value("contributionCount", uint64_t{0});
                 const std::string colorHex = day.value("color", "#FFFFFF");
-                cell.mColor = HexToColorRef(Utf8ToWideString(colorHex));
+                if (TryHexToColorRef(Utf8ToWideString(colorHex), cell.mColor) == false)
+                    return MAKE_ERROR(eErrorCode::InvalidContributionData);
                 cell.mWeek = weekIndex;
                 cell.mDay = dayIndex;
 
@@ -255,12 +287,16 @@ namespace CoTigraphy
             dayIndex = 0;
         }
 
+        // Contribution이 하나도 없으면 지렁이가 움직일 수 없어 프레임이 생기지 않음
+        if (gridData.mMaxCount == 0)
+            return MAKE_ERROR(eErrorCode::InvalidContributionData);
+
         POSTCONDITION(gridData.mWeekCount != 0);
         POSTCONDITION(gridData.mDayCount != 0);
-        POSTCONDITION(gridData.mMaxCount != 0);
         POSTCONDITION(gridData.mCells.empty() == false);
 
-        return gridData;
+        outGridData = std::move(gridData);
+        return MAKE_ERROR(eErrorCode::Succeeded);
     }
 
     std::wstring GitHubContributionCalendarClient::Utf8ToWideString(_In_ const std::string& utf8) const
@@ -295,16 +331,20 @@ namespace CoTigraphy
         return utf8;
     }
 
-    COLORREF GitHubContributionCalendarClient::HexToColorRef(_In_ const std::wstring& hex) const
+    bool GitHubContributionCalendarClient::TryHexToColorRef(_In_ const std::wstring& hex, _Out_ COLORREF& outColor) const
     {
-        PRECONDITION(hex.length() == 7);
-        PRECONDITION(hex[0] == L'#');
+        outColor = 0;
+        if (hex.length() != 7 || hex[0] != L'#')
+            return false;
+        if (std::all_of(hex.begin() + 1, hex.end(), [](const wchar_t ch) { return iswxdigit(ch) != 0; }) == false)
+            return false;
 
         const unsigned int r = std::stoi(hex.substr(1, 2), nullptr, 16);
         const unsigned int g = std::stoi(hex.substr(3, 2), nullptr, 16);
         const unsigned int b = std::stoi(hex.substr(5, 2), nullptr, 16);
 
-        return RGB(r, g, b); // Macro: ((BYTE)(r) | ((BYTE)(g) << 8) | ((BYTE)(b) << 16))
+        outColor = RGB(r, g, b); // Macro: ((BYTE)(r) | ((BYTE)(g) << 8) | ((BYTE)(b) << 16))
+        return true;
     }
 
     size_t GitHubContributionCalendarClient::WriteCallback(const void* contents, const size_t size, const size_t nmemb,
@@ -1,5 +1,5 @@
 ﻿// \file GitHubContributionCalendarClient.hpp
-// \last_updated 2025-06-14
+// \last_updated 2026-10-16
 // \author Oh Sungsik <ohsungsik@outlook.com>
 // \copyright (C) 2025. Oh Sungsik. All rights reserved.
 
@@ -9,6 +9,7 @@
 
 #include <curl/curl.h>
 
+#include "Error.hpp"
 #include "Grid.hpp"
 
 namespace CoTigraphy
@@ -32,13 +33,28 @@ namespace CoTigraphy
         ~GitHubContributionCalendarClient();
 
         /**
-         * \brief curl 초기화
+         * \brief curl 전역 초기화 (curl_global_init)
+         * \details
+         *  - 스레드 안전하지 않으므로 프로세스 시작 시 다른 스레드를 만들기 전에 한 번만 호출
+         */
+        static void GlobalInitialize();
+
+        /**
+         * \brief curl 전역 리소스 해제 (curl_global_cleanup)
+         * \details
+         *  - 모든 클라이언트의 Uninitialize() 이후 한 번만 호출
+         */
+        static void GlobalUninitialize();
+
+        /**
+         * \brief curl 핸들 초기화
+         * \pre GlobalInitialize() 이후 호출
          */
         void Initialize();
 
 
         /**
-         * \brief curl 리소스 해제
+         * \brief curl 핸들 리소스 해제
          */
         void Uninitialize();
 
@@ -53,10 +69,15 @@ namespace CoTigraphy
 
         /**
          * \brief 요청한 Github 사용자로부터 Contribution calendar 정보를 가져온다.
-         * \return Contribution calendar를 GridData 형태로 파싱한 데이터
+         * \param userName GitHub 사용자 로그인 이름
+         * \param fields GraphQL 요청 시 포함할 필드 목록
+         * \param outGridData Contribution calendar를 GridData 형태로 파싱한 데이터
+         * \return 성공 시 Succeeded, 요청 실패 시 NetworkFailure, 응답 형식 오류 시 InvalidContributionData
+         * \details
+         *  - 배치 렌더링에서 한 사용자의 실패가 전체를 중단시키지 않도록 ASSERT 대신 에러를 반환
          */
-        [[nodiscard]] GridData FetchContributionInfo(_In_ const std::wstring& userName,
-                                                     _In_ const std::wstring& fields) const;
+        [[nodiscard]] Error FetchContributionInfo(_In_ const std::wstring& userName, _In_ const std::wstring& fields,
+                                                  _Out_ GridData& outGridData) const;
 
     private:
         /**
@@ -84,9 +105,10 @@ namespace CoTigraphy
         /**
          * \brief GraphQL JSON 응답을 GridData 형태로 파싱
          * \param response UTF-8 인코딩 된 JSON 응답 문자열
-         * \return GridData 형태로 변환된 Contribution calendar 구조체
+         * \param outGridData GridData 형태로 변환된 Contribution calendar 구조체 (실패 시 비어 있음)
+         * \return 성공 시 Succeeded, JSON 형식 오류/없는 사용자/Contribution이 없으면 InvalidContributionData
          */
-        [[nodiscard]] GridData Parse(_In_ const std::string& response) const;
+        [[nodiscard]] Error Parse(_In_ const std::string& response, _Out_ GridData& outGridData) const;
 
         // UTF-8 → wstring 변환
         [[nodiscard]] std::wstring Utf8ToWideString(_In_ const std::string& utf8) const;
@@ -97,9 +119,10 @@ namespace CoTigraphy
         /**
          * \brief HEX 색상 문자열을 COLORREF 형태로 파싱한다.
          * \param hex hex 문자열 e.g) #43FF12
-         * \return COLORREF 값
+         * \param outColor COLORREF 값
+         * \return 형식이 올바르면 true
          */
-        [[nodiscard]] COLORREF HexToColorRef(_In_ const std::wstring& hex) const;
+        [[nodiscard]] bool TryHexToColorRef(_In_ const std::wstring& hex, _Out_ COLORREF& outColor) const;
 
     private:
         // WriteCallback for libcurl
@@ -1,5 +1,5 @@
 ﻿// \file Grid.cpp
-// \last_updated 2025-06-14
+// \last_updated 2026-10-16
 // \author Oh Sungsik <ohsungsik@outlook.com>
 // \copyright (C) 2025. Oh Sungsik. All rights reserved.
 
@@ -8,9 +8,24 @@
 
 namespace CoTigraphy
 {
-    Grid::Grid(GridData gridData) noexcept
-        : mGridData(std::move(gridData))
+    Grid::Grid(_In_ const GridData& gridData)
+        : mWeekCount(gridData.mWeekCount)
+        , mDayCount(gridData.mDayCount)
+        , mCounts(gridData.mWeekCount * gridData.mDayCount, 0)
+        , mColors(gridData.mWeekCount * gridData.mDayCount, 0)
     {
+        // IsInside()로 접근 가능한 셀만 연속 배열로 옮기고 색인
+        for (size_t week = 0; week < mWeekCount && week < gridData.mCells.size(); ++week)
+        {
+            const std::vector<GridCell>& cells = gridData.mCells[week];
+            for (size_t day = 0; day < mDayCount && day < cells.size(); ++day)
+            {
+                const size_t index = week * mDayCount + day;
+                mCounts[index] = cells[day].mCount;
+                mColors[index] = cells[day].mColor;
+                UpdateLevelIndex(0, cells[day].mCount);
+            }
+        }
     }
 
     Grid::~Grid()
@@ -18,44 +33,77 @@ namespace CoTigraphy
 
     size_t Grid::GetDayCount() const noexcept
     {
-        return mGridData.mDayCount;
+        return mDayCount;
     }
 
     size_t Grid::GetWeekCount() const noexcept
     {
-        return mGridData.mWeekCount;
+        return mWeekCount;
     }
 
-    const GridCell& Grid::GetCell(_In_ const size_t& week, _In_ const size_t& day) const
+    size_t Grid::GetCellIndex(_In_ const size_t& week, _In_ const size_t& day) const
     {
         PRECONDITION(IsInside(week, day));
 
-        return mGridData.mCells[week][day];
+        return week * mDayCount + day;
+    }
+
+    COLORREF Grid::GetColor(_In_ const size_t& week, _In_ const size_t& day) const
+    {
+        return mColors[GetCellIndex(week, day)];
     }
 
     bool Grid::IsInside(_In_ const size_t& week, _In_ const size_t& day) const noexcept
     {
-        return week < mGridData.mWeekCount && day < mGridData.mDayCount;
+        return week < mWeekCount && day < mDayCount;
     }
 
     uint64_t Grid::GetContributionCount(_In_ const size_t& week, _In_ const size_t& day) const
     {
-        PRECONDITION(IsInside(week, day));
-
-        return mGridData.mCells[week][day].mCount;
+        return mCounts[GetCellIndex(week, day)];
     }
 
     void Grid::SetContributionCount(_In_ const size_t& week, _In_ const size_t& day, _In_ const uint64_t& level)
     {
-        PRECONDITION(IsInside(week, day));
-
-        mGridData.mCells[week][day].mCount = level;
+        uint64_t& count = mCounts[GetCellIndex(week, day)];
+        UpdateLevelIndex(count, level);
+        count = level;
     }
 
     void Grid::SetColor(_In_ const size_t& week, _In_ const size_t& day, _In_ const COLORREF& color)
     {
-        PRECONDITION(IsInside(week, day));
+        mColors[GetCellIndex(week, day)] = color;
+    }
+
+    bool Grid::HasContributionAtOrBelow(_In_ const uint64_t& level) const noexcept
+    {
+        return mCellCountByLevel.empty() == false && mCellCountByLevel.begin()->first <= level;
+    }
+
+    uint64_t Grid::GetNextContributionLevel(_In_ const uint64_t& level) const
+    {
+        const auto it = mCellCountByLevel.upper_bound(level);
+        if (it == mCellCountByLevel.end())
+            return 0;
+
+        return it->first;
+    }
+
+    void Grid::UpdateLevelIndex(_In_ const uint64_t& oldCount, _In_ const uint64_t& newCount)
+    {
+        if (oldCount == newCount)
+            return;
+
+        if (oldCount != 0)
+        {
+            const auto it = mCellCountByLevel.find(oldCount);
+            ASSERT(it != mCellCountByLevel.end() && it->second > 0);
+
+            if (--it->second == 0)
+                mCellCountByLevel.erase(it);
+        }
 
-        mGridData.mCells[week][day].mColor = color;
+        if (newCount != 0)
+            mCellCountByLevel[newCount]++;
     }
 } // CoTigraphy
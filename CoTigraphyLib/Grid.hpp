@@ -1,10 +1,11 @@
 ﻿// \file Grid.hpp
-// \last_updated 2025-06-14
+// \last_updated 2026-10-16
 // \author Oh Sungsik <ohsungsik@outlook.com>
 // \copyright (C) 2025. Oh Sungsik. All rights reserved.
 
 #pragma once
 
+#include <map>
 #include <vector>
 
 namespace CoTigraphy
@@ -17,6 +18,11 @@ namespace CoTigraphy
         COLORREF mColor = 0;
     };
 
+    /**
+     * \brief GitHub API 응답/시뮬레이션 기록 파일과 주고받는 Contribution calendar 데이터
+     * \details
+     *  - 주(week)별로 나뉜 전달용 형식이며, 렌더링/시뮬레이션 중에는 Grid의 평탄화된 배열을 사용
+     */
     struct GridData
     {
         std::vector<std::vector<GridCell>> mCells;
@@ -25,10 +31,16 @@ namespace CoTigraphy
         uint64_t mMaxCount = 0; // 최대 커밋 횟수
     };
 
+    /**
+     * \brief 시뮬레이션/렌더링 중 사용하는 Contribution calendar
+     * \details
+     *  - 셀 정보를 필드별 연속 배열(Contribution 횟수, 색상)에 저장하며, 인덱스는 week * GetDayCount() + day
+     *  - 한 주(열)의 셀은 연속된 메모리에 있고, 같은 요일(행)의 셀은 GetDayCount() 간격으로 놓임
+     */
     class Grid final
     {
     public:
-        explicit Grid(GridData gridData) noexcept;
+        explicit Grid(_In_ const GridData& gridData);
         Grid(const Grid& other) = delete;
         Grid(Grid&& other) = delete;
 
@@ -43,7 +55,6 @@ namespace CoTigraphy
          * \details
          *  - GitHub Contribution Calendar는 최대 7개의 행을 가짐 (일~토)
          *  - 실제 row 수(day)는 캘린더 기준일에 따라 7 이하일 수 있음
-         *  - mGridData 내부에 저장된 rowCount를 그대로 반환
          */
         [[nodiscard]] size_t GetDayCount() const noexcept;
 
@@ -51,24 +62,68 @@ namespace CoTigraphy
          * \brief 현재 그리드의 열(column) 개수를 반환
          * \return 수평 방향 셀(column)의 개수 (보통 52 또는 53, 주 단위)
          * \details
-         *  - mGridData 내부에 저장된 coloumCount를 그대로 반환
          *  - 이 값은 GitHub Contribution Calendar 상의 주(week) 개수를 나타냄
          *  - API 호출 시 받은 데이터의 실제 주 개수에 따라 달라질 수 있음
          */
         [[nodiscard]] size_t GetWeekCount() const noexcept;
 
         /**
-         * \brief 지정한 좌표에 위치한 GridCell을 반환
+         * \brief 지정한 좌표의 연속 배열 인덱스를 반환
          * \param week 열 인덱스 (0부터 시작, 최대 GetWeekCount() - 1)
          * \param day 행 인덱스 (0부터 시작, 최대 GetDayCount() - 1)
-         * \return 주어진 좌표의 GridCell에 대한 const 참조
-         * \pre IsInside(y, x) == true (그리드 내부 좌표여야 함)
-         * \post 반환되는 참조는 Grid 내부 데이터의 불변 참조
-         * \details
-         *  - 반환된 참조를 통해 셀의 좌표, 색상, 카운트 등을 조회할 수 있음
-         *  - 데이터 변경은 허용되지 않음 (const 참조 반환)
+         * \return week * GetDayCount() + day
+         * \pre IsInside(week, day) == true
+         */
+        [[nodiscard]] size_t GetCellIndex(_In_ const size_t& week, _In_ const size_t& day) const;
+
+        /**
+         * \brief 지정한 좌표의 색상을 반환
+         * \param week 열 인덱스 (0부터 시작, 최대 GetWeekCount() - 1)
+         * \param day 행 인덱스 (0부터 시작, 최대 GetDayCount() - 1)
+         * \pre IsInside(week, day) == true
+         */
+        [[nodiscard]] COLORREF GetColor(_In_ const size_t& week, _In_ const size_t& day) const;
+
+        /**
+         * \brief 모든 셀의 Contribution 횟수 배열을 반환 (GetCellIndex() 순서)
+         */
+        [[nodiscard]] const std::vector<uint64_t>& GetContributionCounts() const noexcept { return mCounts; }
+
+        /**
+         * \brief 모든 셀의 색상 배열을 반환 (GetCellIndex() 순서)
+         */
+        [[nodiscard]] const std::vector<COLORREF>& GetColors() const noexcept { return mColors; }
+
+        /**
+         * \brief 한 주(열)의 셀을 요일 순서로 순회
+         * \param week 열 인덱스 (0부터 시작, 최대 GetWeekCount() - 1)
+         * \param func void(size_t day, uint64_t count, COLORREF color) 형태의 호출 객체
+         * \details 연속된 메모리를 순서대로 읽음
+         */
+        template <typename Func>
+        void ForEachCellInWeek(_In_ const size_t& week, _In_ Func&& func) const
+        {
+            PRECONDITION(week < mWeekCount);
+
+            const size_t begin = week * mDayCount;
+            for (size_t day = 0; day < mDayCount; ++day)
+                func(day, mCounts[begin + day], mColors[begin + day]);
+        }
+
+        /**
+         * \brief 같은 요일(행)의 셀을 주 순서로 순회
+         * \param day 행 인덱스 (0부터 시작, 최대 GetDayCount() - 1)
+         * \param func void(size_t week, uint64_t count, COLORREF color) 형태의 호출 객체
+         * \details GetDayCount() 간격으로 읽음
          */
-        [[nodiscard]] const GridCell& GetCell(_In_ const size_t& week, _In_ const size_t& day) const;
+        template <typename Func>
+        void ForEachCellInDay(_In_ const size_t& day, _In_ Func&& func) const
+        {
+            PRECONDITION(day < mDayCount);
+
+            for (size_t week = 0, index = day; week < mWeekCount; ++week, index += mDayCount)
+                func(week, mCounts[index], mColors[index]);
+        }
 
         /**
          * @brief 지정한 좌표가 Grid 영역 안에 포함되는지 검사
@@ -106,7 +161,39 @@ namespace CoTigraphy
          */
         void SetColor(_In_ const size_t& week, _In_ const size_t& day, _In_ const COLORREF& color);
 
+        /**
+         * \brief 아직 먹히지 않은 셀 중 Contribution 횟수가 level 이하인 셀이 있는지 검사
+         * \param level 현재 레벨
+         * \return Contribution 횟수가 1 이상 level 이하인 셀이 하나라도 있으면 true
+         * \details
+         *  - 남은 셀 중 가장 작은 Contribution 횟수와 비교하므로 O(1)
+         *  - 셀이 지렁이 머리에 가려져 있어도 남은 셀로 취급
+         */
+        [[nodiscard]] bool HasContributionAtOrBelow(_In_ const uint64_t& level) const noexcept;
+
+        /**
+         * \brief level보다 큰 Contribution 횟수 중 남은 셀이 있는 가장 작은 값을 반환
+         * \param level 현재 레벨
+         * \return 다음 레벨, 더 이상 남은 셀이 없으면 0
+         * \details
+         *  - 서로 다른 Contribution 횟수의 개수를 k라 할 때 O(log k)
+         *  - 남은 셀이 없는 레벨은 이전 레벨과 목표 셀 집합이 같으므로 건너뛰어도 결과가 같음
+         */
+        [[nodiscard]] uint64_t GetNextContributionLevel(_In_ const uint64_t& level) const;
+
+    private:
+        /**
+         * \brief Contribution 횟수별 남은 셀 수 색인에서 셀 하나를 옮김
+         * \param oldCount 변경 전 Contribution 횟수
+         * \param newCount 변경 후 Contribution 횟수
+         */
+        void UpdateLevelIndex(_In_ const uint64_t& oldCount, _In_ const uint64_t& newCount);
+
     private:
-        GridData mGridData;
+        size_t mWeekCount = 0; // 열 수 (주 갯수)
+        size_t mDayCount = 0; // 행 수 (요일 갯수, 7 이하)
+        std::vector<uint64_t> mCounts; // 셀별 Contribution 횟수
+        std::vector<COLORREF> mColors; // 셀별 색상
+        std::map<uint64_t, size_t> mCellCountByLevel; // Contribution 횟수(0 제외) -> 해당 횟수인 셀 수
     };
 } // CoTigraphy
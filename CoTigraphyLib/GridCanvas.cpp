@@ -1,5 +1,5 @@
 ﻿// \file GridCanvas.cpp
-// \last_updated 2025-06-14
+// \last_updated 2026-10-16
 // \author Oh Sungsik <ohsungsik@outlook.com>
 // \copyright (C) 2025. Oh Sungsik. All rights reserved.
 
@@ -7,10 +7,23 @@
 #include "GridCanvas.hpp"
 
 #include "Grid.hpp"
+#include "PixelKernels.hpp"
 #include "Worm.hpp"
 
 namespace CoTigraphy
 {
+    namespace
+    {
+        // 32bit 형식과 같은 커널로 팔레트 색상 위에 source를 덮는 비율만큼 섞음
+        uint32_t BlendPaletteColor(_In_ const uint32_t target, _In_ const uint32_t source, _In_ const uint8_t coverage)
+        {
+            uint32_t blended = target;
+            PixelKernels::BlendSpan(reinterpret_cast<uint8_t*>(&blended), reinterpret_cast<const uint8_t*>(&source),
+                                    &coverage, 1, sizeof(uint32_t));
+            return blended;
+        }
+    }
+
     GridCanvas::GridCanvas() noexcept
     = default;
 
@@ -18,6 +31,9 @@ namespace CoTigraphy
     {
         _aligned_free(mBuffer);
         mBuffer = nullptr;
+
+        _aligned_free(mLayer);
+        mLayer = nullptr;
     }
 
     void GridCanvas::Create(const GridCanvasContext& gridCanvasContext)
@@ -25,43 +41,161 @@ namespace CoTigraphy
         PRECONDITION(gridCanvasContext.mWidth != 0);
         PRECONDITION(gridCanvasContext.mHeight != 0);
         PRECONDITION(gridCanvasContext.mCellSize != 0);
-        PRECONDITION(gridCanvasContext.mCellMargin != 0);
+        PRECONDITION(gridCanvasContext.mScale != 0);
 
         mGridCanvasContext = gridCanvasContext;
 
-        mBufferSize = mGridCanvasContext.mWidth * mGridCanvasContext.mHeight * mBytesPerPixel;
+        const size_t pixelCount = mGridCanvasContext.mWidth * mGridCanvasContext.mHeight;
+        if (mGridCanvasContext.mPixelFormat == ePixelFormat::YUV420)
+        {
+            // [Y][U 4:2:0][V 4:2:0]이 프레임, 그 뒤의 [R][G][B]는 U, V 계산에 쓰는 작업 평면
+            const size_t chromaSize = GetChromaWidth() * GetChromaHeight();
+            mBytesPerPixel = 1;
+            mPlaneCount = 4;
+            mFrameSize = pixelCount + 2 * chromaSize;
+            mPlaneOffsets = {0, mFrameSize, mFrameSize + pixelCount, mFrameSize + 2 * pixelCount};
+            mBufferSize = mFrameSize + 3 * pixelCount;
+        }
+        else if (mGridCanvasContext.mPixelFormat == ePixelFormat::Indexed8)
+        {
+            // [팔레트 번호][ARGB 팔레트]가 프레임 (레이어도 같은 팔레트 번호를 사용)
+            mBytesPerPixel = 1;
+            mPlaneCount = 1;
+            mFrameSize = PixelKernels::GetPaletteOffset(pixelCount) + PixelKernels::mPaletteCapacity * sizeof(uint32_t);
+            mPlaneOffsets = {0, 0, 0, 0};
+            mBufferSize = mFrameSize;
+        }
+        else
+        {
+            ASSERT(mGridCanvasContext.mPixelFormat == ePixelFormat::ARGB);
+            mBytesPerPixel = 4;
+            mPlaneCount = 1;
+            mFrameSize = pixelCount * mBytesPerPixel;
+            mPlaneOffsets = {0, 0, 0, 0};
+            mBufferSize = mFrameSize;
+        }
+
+        // 이전에 할당한 버퍼가 충분히 크면 재사용
+        if (mBufferSize > mBufferCapacity)
+        {
+            _aligned_free(mBuffer);
+            mBuffer = static_cast<uint8_t*>(_aligned_malloc(mBufferSize, mAlignmentBits));
+
+            _aligned_free(mLayer);
+            mLayer = static_cast<uint8_t*>(_aligned_malloc(mBufferSize, mAlignmentBits));
+
+            mBufferCapacity = mBufferSize;
+        }
+
+        // 셀 위치는 렌더링 중 바뀌지 않으므로 한 번만 계산
+        const size_t cellStride = (mGridCanvasContext.mCellSize + mGridCanvasContext.mCellMargin) *
+            mGridCanvasContext.mScale;
+        const size_t marginSize = mGridCanvasContext.mCellMargin * mGridCanvasContext.mScale;
+        mWeekCapacity = (mGridCanvasContext.mWidth + marginSize) / cellStride;
+        mDayCapacity = (mGridCanvasContext.mHeight + marginSize) / cellStride;
+
+        mCellRects.resize(mWeekCapacity * mDayCapacity);
+        for (size_t week = 0; week < mWeekCapacity; ++week)
+        {
+            for (size_t day = 0; day < mDayCapacity; ++day)
+                mCellRects[week * mDayCapacity + day] = GetRect(week, day, 1.0f);
+        }
+
+        // 셀 크기/픽셀 형식/색상이 바뀌었을 수 있으므로 이전 작업의 타일은 버리고 공유 캐시에서 다시 조회
+        mTiles.clear();
+
+        // 팔레트는 배경 색상부터 다시 등록
+        mPaletteIndices.clear();
+        mThemedPaletteIndices.clear();
+        mPaletteCount = 0;
+        if (mGridCanvasContext.mPixelFormat == ePixelFormat::Indexed8)
+        {
+            // 팔레트 앞의 정렬용 여백도 비워 프레임 데이터 전체가 그린 내용으로만 정해지도록 함
+            memset(mBuffer + pixelCount, 0, mFrameSize - pixelCount);
 
-        mBuffer = static_cast<uint8_t*>(_aligned_malloc(mBufferSize, mAlignmentBits));
+            uint8_t backgroundIndex = 0;
+            const bool isAdded = AddPaletteColor(
+                PixelKernels::ToPixel(mGridCanvasContext.mBackgroundColor), backgroundIndex);
+            ASSERT(isAdded && backgroundIndex == 0);
+
+            const size_t cellPixelSize = mGridCanvasContext.mCellSize * mGridCanvasContext.mScale;
+            mPaletteScratch.resize(cellPixelSize * cellPixelSize);
+        }
+
+        // 새 캔버스 구성이므로 다음 Render()는 레이어부터 다시 그림
+        Invalidate();
+        SetRectEmpty(&mDirtyRect);
 
         POSTCONDITION(mBuffer);
+        POSTCONDITION(mLayer);
     }
 
-    void GridCanvas::Clear(const COLORREF color) const
+    const uint32_t* GridCanvas::GetPalette() const
     {
-        PRECONDITION(mBuffer != nullptr);
-        PRECONDITION(mBufferSize != 0);
+        PRECONDITION(mGridCanvasContext.mPixelFormat == ePixelFormat::Indexed8);
+
+        return reinterpret_cast<const uint32_t*>(mBuffer + PixelKernels::GetPaletteOffset(
+            mGridCanvasContext.mWidth * mGridCanvasContext.mHeight));
+    }
+
+    void GridCanvas::CopyFrameRows(_Out_ uint8_t* const target, _In_ const RECT& rect) const
+    {
+        PRECONDITION(target != nullptr);
+
+        const RECT canvasRect = GetCanvasRect();
+        RECT copyRect;
+        IntersectRect(&copyRect, &rect, &canvasRect);
 
-        for (size_t i = 0; i < mBufferSize; i += mBytesPerPixel)
+        if (EqualRect(&copyRect, &canvasRect))
         {
-            uint8_t* buffer = mBuffer + i;
-            ASSERT(buffer != nullptr);
+            memcpy(target, mBuffer, mFrameSize);
+            return;
+        }
+
+        const size_t width = mGridCanvasContext.mWidth;
+        const size_t height = mGridCanvasContext.mHeight;
+        if (mGridCanvasContext.mPixelFormat == ePixelFormat::Indexed8)
+        {
+            const size_t paletteOffset = PixelKernels::GetPaletteOffset(width * height);
+            memcpy(target + paletteOffset, mBuffer + paletteOffset, mFrameSize - paletteOffset);
+        }
 
-            *(buffer + 0) = GetRValue(color);
-            *(buffer + 1) = GetGValue(color);
-            *(buffer + 2) = GetBValue(color);
-            *(buffer + 3) = 0xff;
+        if (IsRectEmpty(&copyRect))
+            return;
+
+        const size_t top = static_cast<size_t>(copyRect.top);
+        const size_t bottom = static_cast<size_t>(copyRect.bottom);
+        const size_t rowBytes = width * mBytesPerPixel;
+        memcpy(target + top * rowBytes, mBuffer + top * rowBytes, (bottom - top) * rowBytes);
+
+        if (mGridCanvasContext.mPixelFormat == ePixelFormat::YUV420)
+        {
+            // rect와 겹치는 2×2 블록 줄
+            const size_t chromaWidth = GetChromaWidth();
+            const size_t chromaSize = chromaWidth * GetChromaHeight();
+            const size_t chromaBegin = width * height + (top / 2) * chromaWidth;
+            const size_t chromaBytes = ((bottom + 1) / 2 - top / 2) * chromaWidth;
+            memcpy(target + chromaBegin, mBuffer + chromaBegin, chromaBytes);
+            memcpy(target + chromaBegin + chromaSize, mBuffer + chromaBegin + chromaSize, chromaBytes);
         }
     }
 
+    void GridCanvas::Clear(const COLORREF color) const
+    {
+        PRECONDITION(mBuffer != nullptr);
+        PRECONDITION(mBufferSize != 0);
+
+        FillRect(mBuffer, GetCanvasRect(), color);
+    }
+
     void GridCanvas::DrawGrid(const Grid& grid) const
     {
         for (size_t week = 0; week < grid.GetWeekCount(); ++week)
         {
-            for (size_t day = 0; day < grid.GetDayCount(); ++day)
+            grid.ForEachCellInWeek(week, [this, week](const size_t day, const uint64_t, const COLORREF color)
             {
-                const GridCell& cell = grid.GetCell(week, day);
-                DrawCell(cell.mWeek, cell.mDay, cell.mColor);
-            }
+                DrawCell(week, day, color);
+            });
         }
     }
 
@@ -74,6 +208,117 @@ namespace CoTigraphy
         }
     }
 
+    Error GridCanvas::Render(_In_ const Grid& grid, _In_ const Worm& worm)
+    {
+        PRECONDITION(mBuffer != nullptr);
+        PRECONDITION(mLayer != nullptr);
+
+        const RECT canvasRect = GetCanvasRect();
+
+        if (mIsFrameValid == false)
+        {
+            const bool drawLayer = mIsLayerValid == false;
+
+            // 팔레트가 넘치면 아무것도 그리지 않도록 그릴 색상을 정해진 순서로 미리 등록
+            if (mGridCanvasContext.mPixelFormat == ePixelFormat::Indexed8)
+            {
+                if (drawLayer)
+                {
+                    // 같은 색상의 셀은 같은 색상을 만들므로 색상마다 한 셀만 등록
+                    std::vector<COLORREF> registeredColors;
+                    bool isRegistered = true;
+                    for (size_t week = 0; week < grid.GetWeekCount() && isRegistered; ++week)
+                    {
+                        grid.ForEachCellInWeek(week, [this, week, &grid, &worm, &registeredColors, &isRegistered](
+                                               const size_t day, const uint64_t, const COLORREF color)
+                                               {
+                                                   if (isRegistered == false ||
+                                                       std::find(registeredColors.begin(), registeredColors.end(),
+                                                                 color) != registeredColors.end())
+                                                       return;
+
+                                                   registeredColors.push_back(color);
+                                                   isRegistered = RegisterCellPalette(grid, worm, week, day, false);
+                                               });
+                    }
+                    if (isRegistered == false)
+                        return MAKE_ERROR(eErrorCode::PaletteOverflow);
+                }
+
+                for (const WormSegment& wormSegment : worm.GetWorm())
+                {
+                    if (RegisterCellPalette(grid, worm, static_cast<size_t>(wormSegment.mPoint.x),
+                                            static_cast<size_t>(wormSegment.mPoint.y), true) == false)
+                        return MAKE_ERROR(eErrorCode::PaletteOverflow);
+                }
+            }
+
+            // 배경 + 그리드 레이어를 (필요하면) 그린 뒤 레이어 복사 + 지렁이로 프레임을 완성
+            if (drawLayer)
+                DrawLayer(grid);
+            DrawFrame(worm);
+
+            mIsLayerValid = true;
+            mIsFrameValid = true;
+            mDirtyRect = canvasRect;
+            return MAKE_ERROR(eErrorCode::Succeeded);
+        }
+
+        // 레이어가 무효이면 프레임도 무효 (Invalidate()는 둘을 함께 무효로 만듦)
+        ASSERT(mIsLayerValid);
+
+        SetRectEmpty(&mDirtyRect);
+
+        // 바뀐 셀과 그 위의 지렁이 구간이 만드는 색상을 그리기 전에 등록
+        const std::vector<POINT>& dirtyCells = worm.GetDirtyCells();
+        if (mGridCanvasContext.mPixelFormat == ePixelFormat::Indexed8)
+        {
+            for (const POINT& dirtyCell : dirtyCells)
+            {
+                if (RegisterCellPalette(grid, worm, static_cast<size_t>(dirtyCell.x), static_cast<size_t>(dirtyCell.y),
+                                        true) == false)
+                    return MAKE_ERROR(eErrorCode::PaletteOverflow);
+            }
+        }
+
+        // 바뀐 셀을 레이어에 반영한 뒤 레이어에서 프레임으로 복사
+        for (const POINT& dirtyCell : dirtyCells)
+        {
+            const size_t week = static_cast<size_t>(dirtyCell.x);
+            const size_t day = static_cast<size_t>(dirtyCell.y);
+            if (grid.IsInside(week, day) == false)
+                continue;
+
+            const RECT& cellRect = GetCellRect(week, day);
+            const COLORREF color = grid.GetColor(week, day);
+
+            // 가장자리를 섞는 타일은 이전 셀 대신 배경 위에 다시 그려야 함
+            if (GetTile(color, 1.0f).mCoverage.empty() == false)
+                FillRect(mLayer, cellRect, mGridCanvasContext.mBackgroundColor);
+
+            DrawTile(mLayer, week, day, 1.0f, color, canvasRect);
+            CopyRectFromLayer(cellRect);
+
+            UnionRect(&mDirtyRect, &mDirtyRect, &cellRect);
+        }
+
+        // 다시 칠한 셀 위에 있는 지렁이 구간을 DrawWorm()과 같은 순서로 다시 그림
+        const std::array<WormSegment, 4>& wormSegments = worm.GetWorm();
+        for (const auto& wormInfo : wormSegments)
+        {
+            const bool isDirty = std::any_of(dirtyCells.begin(), dirtyCells.end(), [&wormInfo](const POINT& cell)
+            {
+                return cell.x == wormInfo.mPoint.x && cell.y == wormInfo.mPoint.y;
+            });
+
+            if (isDirty)
+                DrawCellWithScale(wormInfo.mPoint.x, wormInfo.mPoint.y, wormInfo.mScale, wormInfo.mColor);
+        }
+
+        ResolveChroma(mDirtyRect);
+        return MAKE_ERROR(eErrorCode::Succeeded);
+    }
+
     void GridCanvas::DrawCell(_In_ const size_t& week, _In_ const size_t& day, _In_ const COLORREF color) const
     {
         DrawCellWithScale(week, day, 1.0f, color);
@@ -84,7 +329,180 @@ namespace CoTigraphy
     {
         PRECONDITION(mGridCanvasContext.mCellSize != 0);
 
-        const RECT rect = GetRect(week, day, scale);
+        DrawTile(mBuffer, week, day, scale, color, GetCanvasRect());
+    }
+
+    RECT GridCanvas::GetCanvasRect() const noexcept
+    {
+        return {0, 0, static_cast<LONG>(mGridCanvasContext.mWidth), static_cast<LONG>(mGridCanvasContext.mHeight)};
+    }
+
+    void GridCanvas::DrawLayer(_In_ const Grid& grid) const
+    {
+        const RECT canvasRect = GetCanvasRect();
+
+        FillRect(mLayer, canvasRect, mGridCanvasContext.mBackgroundColor);
+        for (size_t week = 0; week < grid.GetWeekCount(); ++week)
+        {
+            grid.ForEachCellInWeek(week, [this, week, &canvasRect](const size_t day, const uint64_t,
+                                                                    const COLORREF color)
+            {
+                DrawTile(mLayer, week, day, 1.0f, color, canvasRect);
+            });
+        }
+    }
+
+    void GridCanvas::DrawFrame(_In_ const Worm& worm) const
+    {
+        const RECT canvasRect = GetCanvasRect();
+
+        // 칠하는 평면만 복사 (YUV420의 출력 U, V 평면은 ResolveChroma()가 채움)
+        CopyRectFromLayer(canvasRect);
+        for (const WormSegment& wormSegment : worm.GetWorm())
+        {
+            DrawTile(mBuffer, static_cast<size_t>(wormSegment.mPoint.x), static_cast<size_t>(wormSegment.mPoint.y),
+                     wormSegment.mScale, wormSegment.mColor, canvasRect);
+        }
+
+        ResolveChroma(canvasRect);
+    }
+
+    void GridCanvas::DrawTile(_In_ uint8_t* const target, _In_ const size_t week, _In_ const size_t day,
+                              _In_ const float scale, _In_ const COLORREF color, _In_ const RECT& clipRect) const
+    {
+        PRECONDITION(target != nullptr);
+
+        const CellTile& cellTile = GetTile(color, scale);
+
+        // 셀 왼쪽 위 좌표 + 타일 영역 (출력 픽셀 기준)
+        const size_t cellStride = (mGridCanvasContext.mCellSize + mGridCanvasContext.mCellMargin) *
+            mGridCanvasContext.mScale;
+        const LONG cellLeft = static_cast<LONG>(week * cellStride);
+        const LONG cellTop = static_cast<LONG>(day * cellStride);
+
+        const LONG left = std::max(clipRect.left, cellLeft + cellTile.mRect.left);
+        const LONG top = std::max(clipRect.top, cellTop + cellTile.mRect.top);
+        const LONG right = std::min(clipRect.right, cellLeft + cellTile.mRect.right);
+        const LONG bottom = std::min(clipRect.bottom, cellTop + cellTile.mRect.bottom);
+
+        if (left >= right || top >= bottom)
+            return;
+
+        const size_t stride = mGridCanvasContext.mWidth * mBytesPerPixel;
+        const size_t spanBytes = static_cast<size_t>(right - left) * mBytesPerPixel;
+        const size_t tileWidth = static_cast<size_t>(cellTile.mRect.right - cellTile.mRect.left);
+        const size_t tileHeight = static_cast<size_t>(cellTile.mRect.bottom - cellTile.mRect.top);
+        const size_t tileLeftPixel = static_cast<size_t>(left - cellLeft - cellTile.mRect.left);
+        const size_t tileLeft = tileLeftPixel * mBytesPerPixel;
+        const bool isOpaque = cellTile.mCoverage.empty();
+
+        if (mGridCanvasContext.mPixelFormat == ePixelFormat::Indexed8)
+        {
+            // 타일은 모양만 가지므로 불투명한 줄은 팔레트 번호로 채우고 가장자리만 섞음
+            const auto& [themeColor, paletteIndex] = GetThemedPaletteIndex(color);
+            for (LONG yPos = top; yPos < bottom; ++yPos)
+            {
+                const size_t tileRow = static_cast<size_t>(yPos - cellTop - cellTile.mRect.top);
+                uint8_t* const targetRow = target + static_cast<size_t>(yPos) * stride + static_cast<size_t>(left);
+
+                if (isOpaque)
+                    memset(targetRow, paletteIndex, spanBytes);
+                else
+                    BlendIndexedSpan(targetRow, cellTile.mCoverage.data() + tileRow * tileWidth + tileLeftPixel,
+                                     static_cast<size_t>(right - left), themeColor);
+            }
+            return;
+        }
+
+        // YUV420에서 섞이는 픽셀의 Y는 R, G, B를 먼저 섞은 뒤 그 색으로 계산
+        const bool resolvesLuma = (mGridCanvasContext.mPixelFormat == ePixelFormat::YUV420) && (isOpaque == false);
+        for (size_t plane = resolvesLuma ? 1 : 0; plane < mPlaneCount; ++plane)
+        {
+            const uint8_t* const tilePlane = cellTile.mPixels.data() + plane * tileHeight * cellTile.mRowSize;
+            for (LONG yPos = top; yPos < bottom; ++yPos)
+            {
+                const size_t tileRow = static_cast<size_t>(yPos - cellTop - cellTile.mRect.top);
+                uint8_t* const targetRow = target + mPlaneOffsets[plane] + static_cast<size_t>(yPos) * stride +
+                    static_cast<size_t>(left) * mBytesPerPixel;
+                const uint8_t* const tileRowPixels = tilePlane + tileRow * cellTile.mRowSize + tileLeft;
+
+                if (isOpaque)
+                    memcpy(targetRow, tileRowPixels, spanBytes);
+                else
+                    PixelKernels::BlendSpan(targetRow, tileRowPixels,
+                                            cellTile.mCoverage.data() + tileRow * tileWidth + tileLeftPixel,
+                                            static_cast<size_t>(right - left), mBytesPerPixel);
+            }
+        }
+
+        if (resolvesLuma == false)
+            return;
+
+        // Y 평면끼리 섞으면 섞인 R, G, B(= U, V)와 밝기가 어긋나므로 덮인 픽셀만 섞인 색의 Y로 갱신
+        const size_t spanWidth = static_cast<size_t>(right - left);
+        for (LONG yPos = top; yPos < bottom; ++yPos)
+        {
+            const size_t tileRow = static_cast<size_t>(yPos - cellTop - cellTile.mRect.top);
+            const size_t rowOffset = static_cast<size_t>(yPos) * stride + static_cast<size_t>(left);
+            const uint8_t* const coverage = cellTile.mCoverage.data() + tileRow * tileWidth + tileLeftPixel;
+            const uint8_t* const red = target + mPlaneOffsets[1] + rowOffset;
+            const uint8_t* const green = target + mPlaneOffsets[2] + rowOffset;
+            const uint8_t* const blue = target + mPlaneOffsets[3] + rowOffset;
+            uint8_t* const luma = target + mPlaneOffsets[0] + rowOffset;
+
+            for (size_t pixel = 0; pixel < spanWidth; ++pixel)
+            {
+                if (coverage[pixel] != 0)
+                    luma[pixel] = PixelKernels::ToLuma(RGB(red[pixel], green[pixel], blue[pixel]));
+            }
+        }
+    }
+
+    const CellTile& GridCanvas::GetTile(_In_ const COLORREF color, _In_ const float scale) const
+    {
+        TileKey tileKey;
+        tileKey.mColor = color;
+        tileKey.mScaleStep = TileKey::QuantizeScale(scale);
+        tileKey.mCellSize = mGridCanvasContext.mCellSize;
+        tileKey.mCornerRadius = mGridCanvasContext.mCellRadius;
+        tileKey.mUpscale = mGridCanvasContext.mScale;
+        tileKey.mPixelFormat = mGridCanvasContext.mPixelFormat;
+
+        for (const auto& [cachedKey, cellTile] : mTiles)
+        {
+            if (cachedKey == tileKey)
+                return *cellTile;
+        }
+
+        TileKey themedTileKey = tileKey;
+        themedTileKey.mColor = GetThemeColor(color);
+
+        mTiles.emplace_back(tileKey, TileCache::GetShared().GetTile(themedTileKey));
+        return *mTiles.back().second;
+    }
+
+    COLORREF GridCanvas::GetThemeColor(_In_ const COLORREF color) const noexcept
+    {
+        for (const auto& [sourceColor, themeColor] : mGridCanvasContext.mColorTable)
+        {
+            if (sourceColor == color)
+                return themeColor;
+        }
+
+        return color;
+    }
+
+    const RECT& GridCanvas::GetCellRect(_In_ const size_t& week, _In_ const size_t& day) const
+    {
+        PRECONDITION(week < mWeekCapacity);
+        PRECONDITION(day < mDayCapacity);
+
+        return mCellRects[week * mDayCapacity + day];
+    }
+
+    void GridCanvas::FillRect(_In_ uint8_t* const target, _In_ const RECT& rect, _In_ const COLORREF color) const
+    {
+        PRECONDITION(target != nullptr);
 
         ASSERT(mGridCanvasContext.mWidth <= static_cast<size_t>(std::numeric_limits<LONG>::max()));
         ASSERT(mGridCanvasContext.mHeight <= static_cast<size_t>(std::numeric_limits<LONG>::max()));
@@ -97,28 +515,244 @@ namespace CoTigraphy
         const LONG top = std::max<LONG>(0, rect.top);
         const LONG bottom = std::min(height, rect.bottom);
 
-        // 바이트 접근 오프셋 정의
-        constexpr size_t red = 0;
-        constexpr size_t green = 1;
-        constexpr size_t blue = 2;
-        constexpr size_t alpha = 3;
+        if (left >= right || top >= bottom)
+            return;
+
+        const size_t spanWidth = static_cast<size_t>(right - left);
+        if (mGridCanvasContext.mPixelFormat == ePixelFormat::YUV420)
+        {
+            // 색상마다 한 번 계산한 Y 값과 R, G, B 채널 값으로 평면마다 채움
+            const std::array<uint8_t, 4> planeValues = {
+                PixelKernels::ToLuma(color), GetRValue(color), GetGValue(color), GetBValue(color)
+            };
+            for (size_t plane = 0; plane < mPlaneCount; ++plane)
+            {
+                uint8_t* row = target + mPlaneOffsets[plane] + static_cast<size_t>(top) * mGridCanvasContext.mWidth +
+                    static_cast<size_t>(left);
+                for (LONG yPos = top; yPos < bottom; ++yPos, row += mGridCanvasContext.mWidth)
+                    memset(row, planeValues[plane], spanWidth);
+            }
+            return;
+        }
+
+        if (mGridCanvasContext.mPixelFormat == ePixelFormat::Indexed8)
+        {
+            const uint8_t paletteIndex = GetPaletteIndex(color);
+            uint8_t* row = target + static_cast<size_t>(top) * mGridCanvasContext.mWidth + static_cast<size_t>(left);
+            for (LONG yPos = top; yPos < bottom; ++yPos, row += mGridCanvasContext.mWidth)
+                memset(row, paletteIndex, spanWidth);
+            return;
+        }
+
+        // 첫 줄만 32bit 픽셀 단위로 채우고 나머지 줄은 복사
+        const size_t stride = mGridCanvasContext.mWidth * mBytesPerPixel;
+        uint8_t* const origin = target + static_cast<size_t>(top) * stride + static_cast<size_t>(left) *
+            mBytesPerPixel;
+
+        PixelKernels::FillRect(origin, stride, spanWidth, static_cast<size_t>(bottom - top),
+                               PixelKernels::ToPixel(color));
+    }
+
+    uint8_t GridCanvas::GetPaletteIndex(_In_ const COLORREF color) const
+    {
+        return FindPaletteIndex(PixelKernels::ToPixel(color));
+    }
+
+    const std::pair<COLORREF, uint8_t>& GridCanvas::GetThemedPaletteIndex(_In_ const COLORREF color) const
+    {
+        const auto found = mThemedPaletteIndices.find(color);
+        ASSERT(found != mThemedPaletteIndices.end());
+
+        return found->second;
+    }
+
+    void GridCanvas::BlendIndexedSpan(_Inout_ uint8_t* target, _In_ const uint8_t* coverage,
+                                      _In_ const size_t count, _In_ const COLORREF color) const
+    {
+        const uint32_t source = PixelKernels::ToPixel(color);
+        const uint32_t* const palette = GetPalette();
+
+        for (size_t pixel = 0; pixel < count; ++pixel)
+        {
+            if (coverage[pixel] != 0)
+                target[pixel] = FindPaletteIndex(BlendPaletteColor(palette[target[pixel]], source, coverage[pixel]));
+        }
+    }
+
+    uint8_t GridCanvas::FindPaletteIndex(_In_ const uint32_t argb) const
+    {
+        const auto found = mPaletteIndices.find(argb);
+        ASSERT(found != mPaletteIndices.end());
+
+        return found->second;
+    }
+
+    bool GridCanvas::AddPaletteColor(_In_ const uint32_t argb, _Out_ uint8_t& paletteIndex)
+    {
+        const auto found = mPaletteIndices.find(argb);
+        if (found != mPaletteIndices.end())
+        {
+            paletteIndex = found->second;
+            return true;
+        }
+
+        if (mPaletteCount >= PixelKernels::mPaletteCapacity)
+            return false;
+
+        paletteIndex = static_cast<uint8_t>(mPaletteCount++);
+        const_cast<uint32_t*>(GetPalette())[paletteIndex] = argb;
+        mPaletteIndices.emplace(argb, paletteIndex);
+        return true;
+    }
+
+    bool GridCanvas::RegisterCellPalette(_In_ const Grid& grid, _In_ const Worm& worm, _In_ const size_t week,
+                                         _In_ const size_t day, _In_ const bool includeWorm)
+    {
+        // 셀 하나 크기의 작업 버퍼에 배경 -> 셀 -> 지렁이 구간을 Render()와 같은 순서로 겹쳐 칠함
+        std::fill(mPaletteScratch.begin(), mPaletteScratch.end(), static_cast<uint8_t>(0));
+
+        if (grid.IsInside(week, day))
+        {
+            const COLORREF color = grid.GetColor(week, day);
+            if (RegisterTilePalette(GetTile(color, 1.0f), color) == false)
+                return false;
+        }
+
+        if (includeWorm == false)
+            return true;
+
+        for (const WormSegment& wormSegment : worm.GetWorm())
+        {
+            if (static_cast<size_t>(wormSegment.mPoint.x) != week || static_cast<size_t>(wormSegment.mPoint.y) != day)
+                continue;
+
+            if (RegisterTilePalette(GetTile(wormSegment.mColor, wormSegment.mScale), wormSegment.mColor) == false)
+                return false;
+        }
+
+        return true;
+    }
+
+    bool GridCanvas::RegisterTilePalette(_In_ const CellTile& cellTile, _In_ const COLORREF color)
+    {
+        // DrawTile()은 덮는 비율이 있는 타일에서도 불투명한 색상 번호를 조회하므로 먼저 등록
+        const COLORREF themeColor = GetThemeColor(color);
+        const uint32_t source = PixelKernels::ToPixel(themeColor);
+        uint8_t sourceIndex = 0;
+        if (AddPaletteColor(source, sourceIndex) == false)
+            return false;
 
-        // RGB을 COLORREF로 부터 얻어온다
-        const uint8_t r = GetRValue(color);
-        const uint8_t g = GetGValue(color);
-        const uint8_t b = GetBValue(color);
-        constexpr uint8_t a = 255;
+        mThemedPaletteIndices.emplace(color, std::make_pair(themeColor, sourceIndex));
 
-        for (size_t yPos = top; yPos < static_cast<size_t>(bottom); ++yPos)
+        const size_t tileWidth = static_cast<size_t>(std::max<LONG>(0, cellTile.mRect.right - cellTile.mRect.left));
+        const size_t tileHeight = static_cast<size_t>(std::max<LONG>(0, cellTile.mRect.bottom - cellTile.mRect.top));
+        if (tileWidth == 0 || tileHeight == 0)
+            return true;
+
+        const size_t scratchWidth = mGridCanvasContext.mCellSize * mGridCanvasContext.mScale;
+        PRECONDITION(0 <= cellTile.mRect.left && 0 <= cellTile.mRect.top);
+        PRECONDITION(static_cast<size_t>(cellTile.mRect.right) <= scratchWidth);
+        PRECONDITION(static_cast<size_t>(cellTile.mRect.bottom) <= scratchWidth);
+
+        const uint32_t* const palette = GetPalette();
+
+        for (size_t tileRow = 0; tileRow < tileHeight; ++tileRow)
+        {
+            uint8_t* const scratchRow = mPaletteScratch.data() +
+                (static_cast<size_t>(cellTile.mRect.top) + tileRow) * scratchWidth +
+                static_cast<size_t>(cellTile.mRect.left);
+
+            if (cellTile.mCoverage.empty())
+            {
+                memset(scratchRow, sourceIndex, tileWidth);
+                continue;
+            }
+
+            const uint8_t* const coverage = cellTile.mCoverage.data() + tileRow * tileWidth;
+            for (size_t pixel = 0; pixel < tileWidth; ++pixel)
+            {
+                if (coverage[pixel] == 0)
+                    continue;
+
+                if (AddPaletteColor(BlendPaletteColor(palette[scratchRow[pixel]], source, coverage[pixel]),
+                                    scratchRow[pixel]) == false)
+                    return false;
+            }
+        }
+
+        return true;
+    }
+
+    void GridCanvas::CopyRectFromLayer(_In_ const RECT& rect) const
+    {
+        PRECONDITION(0 <= rect.left && rect.left <= rect.right);
+        PRECONDITION(0 <= rect.top && rect.top <= rect.bottom);
+        PRECONDITION(static_cast<size_t>(rect.right) <= mGridCanvasContext.mWidth);
+        PRECONDITION(static_cast<size_t>(rect.bottom) <= mGridCanvasContext.mHeight);
+
+        const size_t stride = mGridCanvasContext.mWidth * mBytesPerPixel;
+        const size_t spanBytes = static_cast<size_t>(rect.right - rect.left) * mBytesPerPixel;
+
+        for (size_t plane = 0; plane < mPlaneCount; ++plane)
+        {
+            for (LONG yPos = rect.top; yPos < rect.bottom; ++yPos)
+            {
+                const size_t offset = mPlaneOffsets[plane] + static_cast<size_t>(yPos) * stride +
+                    static_cast<size_t>(rect.left) * mBytesPerPixel;
+                memcpy(mBuffer + offset, mLayer + offset, spanBytes);
+            }
+        }
+    }
+
+    void GridCanvas::ResolveChroma(_In_ const RECT& rect) const
+    {
+        if (mGridCanvasContext.mPixelFormat != ePixelFormat::YUV420 || IsRectEmpty(&rect))
+            return;
+
+        PRECONDITION(0 <= rect.left && rect.left <= rect.right);
+        PRECONDITION(0 <= rect.top && rect.top <= rect.bottom);
+        PRECONDITION(static_cast<size_t>(rect.right) <= mGridCanvasContext.mWidth);
+        PRECONDITION(static_cast<size_t>(rect.bottom) <= mGridCanvasContext.mHeight);
+
+        const size_t width = mGridCanvasContext.mWidth;
+        const size_t height = mGridCanvasContext.mHeight;
+        const size_t lastX = static_cast<size_t>(rect.right) - 1;
+        const size_t lastY = static_cast<size_t>(rect.bottom) - 1;
+        const size_t chromaWidth = GetChromaWidth();
+        const size_t chromaSize = chromaWidth * GetChromaHeight();
+
+        // rect와 겹치는 2×2 블록 범위
+        const size_t blockLeft = static_cast<size_t>(rect.left) / 2;
+        const size_t blockRight = (static_cast<size_t>(rect.right) + 1) / 2;
+        const size_t blockTop = static_cast<size_t>(rect.top) / 2;
+        const size_t blockBottom = (static_cast<size_t>(rect.bottom) + 1) / 2;
+
+        const uint8_t* const red = mBuffer + mPlaneOffsets[1];
+        const uint8_t* const green = mBuffer + mPlaneOffsets[2];
+        const uint8_t* const blue = mBuffer + mPlaneOffsets[3];
+        uint8_t* const outputU = mBuffer + width * height;
+        uint8_t* const outputV = outputU + chromaSize;
+
+        const auto getColor = [red, green, blue](const size_t offset)
         {
-            for (size_t xPos = left; xPos < static_cast<size_t>(right); ++xPos)
+            return RGB(red[offset], green[offset], blue[offset]);
+        };
+
+        for (size_t blockY = blockTop; blockY < blockBottom; ++blockY)
+        {
+            const size_t row0 = (blockY * 2) * width;
+            const size_t row1 = std::min(blockY * 2 + 1, lastY) * width;
+
+            for (size_t blockX = blockLeft; blockX < blockRight; ++blockX)
             {
-                const size_t index = (yPos * mGridCanvasContext.mWidth + xPos)
-                    * mBytesPerPixel;
-                mBuffer[index + red] = r;
-                mBuffer[index + green] = g;
-                mBuffer[index + blue] = b;
-                mBuffer[index + alpha] = a;
+                const size_t x0 = blockX * 2;
+                const size_t x1 = std::min(x0 + 1, lastX);
+
+                const ChromaPixel chromaPixel = PixelKernels::ToChroma({
+                    getColor(row0 + x0), getColor(row0 + x1), getColor(row1 + x0), getColor(row1 + x1)
+                });
+                outputU[blockY * chromaWidth + blockX] = chromaPixel.mU;
+                outputV[blockY * chromaWidth + blockX] = chromaPixel.mV;
             }
         }
     }
@@ -165,6 +799,8 @@ namespace CoTigraphy
         const LONG top = static_cast<LONG>(centerY - halfHeight);
         const LONG bottom = static_cast<LONG>(centerY + halfHeight);
 
-        return {left, top, right, bottom};
+        // 논리 좌표를 출력 픽셀 블록 크기만큼 확대
+        const LONG outputScale = static_cast<LONG>(mGridCanvasContext.mScale);
+        return {left * outputScale, top * outputScale, right * outputScale, bottom * outputScale};
     }
 } // CoTigraphy
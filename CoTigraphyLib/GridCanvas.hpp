@@ -1,10 +1,19 @@
 ﻿// \file GridCanvas.hpp
-// \last_updated 2025-06-14
+// \last_updated 2026-10-16
 // \author Oh Sungsik <ohsungsik@outlook.com>
 // \copyright (C) 2025. Oh Sungsik. All rights reserved.
 
 #pragma once
 
+#include <array>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Error.hpp"
+#include "PixelKernels.hpp"
+#include "TileCache.hpp"
+
 namespace CoTigraphy
 {
     class Grid;
@@ -15,17 +24,33 @@ namespace CoTigraphy
      */
     struct GridCanvasContext
     {
-        size_t mWidth = 0; // 전체 캔버스의 가로 픽셀 수
-        size_t mHeight = 0; // 전체 캔버스의 세로 픽셀 수
-        size_t mCellSize = 0; // 각 셀의 한 변 길이 (픽셀 단위)
-        size_t mCellMargin = 0; // 셀 간의 간격 (픽셀 단위)
+        size_t mWidth = 0; // 전체 캔버스의 가로 픽셀 수 (출력 픽셀, 논리 크기 × mScale)
+        size_t mHeight = 0; // 전체 캔버스의 세로 픽셀 수 (출력 픽셀, 논리 크기 × mScale)
+        size_t mCellSize = 0; // 각 셀의 한 변 길이 (논리 픽셀 단위)
+        size_t mCellMargin = 0; // 셀 간의 간격 (논리 픽셀 단위)
+        size_t mCellRadius = 0; // 셀 모서리 반지름 (논리 픽셀 단위, 0: 직각)
+        size_t mScale = 1; // 논리 픽셀 하나를 그리는 출력 픽셀 블록 크기 (N×N, HiDPI 출력용)
+        COLORREF mBackgroundColor = RGB(0x01, 0x04, 0x09); // 셀 사이 여백(배경) 색상
+        std::vector<std::pair<COLORREF, COLORREF>> mColorTable; // 셀을 그릴 때 바꿀 색상 (원래 색상, 그릴 색상), 비어 있으면 그대로
+        ePixelFormat mPixelFormat = ePixelFormat::Indexed8; // 버퍼의 픽셀 형식 (FrameWriter에 넘길 때는 FrameWriter::GetPixelFormat())
     };
 
     /**
-     * @brief RGBA 버퍼 기반의 그리드 렌더링 캔버스를 관리하는 클래스
+     * @brief 픽셀 버퍼 기반의 그리드 렌더링 캔버스를 관리하는 클래스
      * @details
      * - 외부에서 전달된 Grid/Worm 정보를 기반으로 그리드 셀과 지렁이(Worm)를 그림
-     * - 내부적으로 RGBA 포맷의 메모리 버퍼를 직접 관리
+     * - 내부적으로 GridCanvasContext::mPixelFormat 형식(ARGB, YUV420 또는 Indexed8)의 메모리 버퍼를 직접 관리
+     * - ARGB는 무손실 WebPMuxWriter가 변경 영역을 변환 없이 WebPPicture::argb로 넘기는 형식
+     * - YUV420은 색상마다 계산한 Y 값으로 Y 평면을 직접 칠하고, U, V는 변경 영역의 2×2 블록만 계산하므로
+     *   인코더의 프레임 전체 RGB -> YUV 변환이 필요 없음 (셀 경계가 블록을 가로지르므로 R, G, B 작업 평면을 함께 칠함)
+     * - Indexed8은 픽셀마다 팔레트 번호 1바이트만 칠하고 (32bit 형식의 1/4), 색상은 버퍼 뒤의 팔레트에 한 번씩만 등록
+     *   (섞은 가장자리 색상도 그리기 전에 정해진 순서로 등록, 256색을 넘으면 아무것도 그리지 않고 Render() 실패)
+     * - Render()는 이전 프레임을 유지한 채 Worm이 알려준 변경 셀만 다시 그림 (dirty rectangle)
+     * - 배경 + 그리드는 별도 레이어에 한 번만 그려 두고, 프레임은 레이어를 복사해 만듦
+     * - 셀은 TileCache가 (색상, 크기 비율)마다 한 번 래스터화한 타일을 줄 단위로 복사해 그림
+     * - GridCanvasContext::mColorTable(테마)은 타일을 처음 조회할 때 적용하므로 그 뒤의 셀 그리기에는 비용이 없음
+     * - 둥근 모서리나 픽셀 경계에 맞지 않는 크기 비율의 가장자리는 타일의 덮는 비율로 아래 픽셀과 섞음
+     * - 셀 위치와 모양은 논리 해상도에서 계산하고 mScale배 정수 확대한 좌표/타일로 그림
      */
     class GridCanvas final
     {
@@ -46,18 +71,60 @@ namespace CoTigraphy
          * @brief 내부 캔버스 버퍼를 생성하고 초기화
          * @param gridCanvasContext 캔버스 크기, 셀 크기, 마진 등의 초기 구성 정보
          * @pre 각 항목이 유효한 값이어야 함 (0이 아니어야 함)
+         * @details
+         * - 다시 호출되면 기존 버퍼가 충분히 큰 경우 재할당 없이 재사용
          */
         void Create(const GridCanvasContext& gridCanvasContext);
 
         /**
-         * @brief RGBA 버퍼의 포인터를 반환
-         * @return 내부 픽셀 데이터가 저장된 버퍼 포인터
+         * @brief 픽셀 버퍼의 포인터를 반환
+         * @return 내부 픽셀 데이터가 저장된 버퍼 포인터 (GridCanvasContext::mPixelFormat 형식)
+         * @details
+         * - YUV420은 Y 평면 바로 뒤에 U, V 평면이 이어짐 (GetChromaWidth() × GetChromaHeight())
+         * - Indexed8은 팔레트 번호 뒤 PixelKernels::GetPaletteOffset() 위치에 ARGB 팔레트가 이어짐 (GetPalette())
          */
         [[nodiscard]] const uint8_t* GetBuffer() const noexcept { return mBuffer; }
 
+        /**
+         * @brief GetBuffer()가 가리키는 프레임 데이터의 바이트 크기를 반환
+         * @return ARGB: width × height × 4, YUV420: width × height + 2 × GetChromaWidth() × GetChromaHeight(),
+         *         Indexed8: PixelKernels::GetPaletteOffset(width × height) + 팔레트 256색 × 4
+         */
+        [[nodiscard]] size_t GetBufferSize() const noexcept { return mFrameSize; }
+
+        /**
+         * @brief Indexed8 버퍼의 ARGB 팔레트를 반환
+         * @pre GridCanvasContext::mPixelFormat == ePixelFormat::Indexed8
+         * @return PixelKernels::mPaletteCapacity개의 ARGB 색상 (사용하지 않은 번호는 0)
+         */
+        [[nodiscard]] const uint32_t* GetPalette() const;
+
+        /**
+         * @brief GetBuffer()의 프레임 데이터 중 rect와 겹치는 줄만 target으로 복사
+         * @param target GetBufferSize() 이상의 버퍼 (rect 밖은 이전 내용 유지)
+         * @param rect 복사할 영역 (캔버스 밖은 잘라냄, 캔버스 전체를 덮으면 프레임 데이터 전체를 한 번에 복사)
+         * @details
+         * - 줄 전체를 복사하므로 평면마다 memcpy 한 번 (YUV420은 Y 줄과 겹치는 U, V 블록 줄)
+         * - Indexed8의 팔레트는 rect와 관계없이 항상 복사 (Render()가 새 색상을 등록할 수 있음)
+         */
+        void CopyFrameRows(_Out_ uint8_t* const target, _In_ const RECT& rect) const;
+
+        /**
+         * @brief YUV420 U, V 평면의 가로 픽셀 수 ((width + 1) / 2)
+         */
+        [[nodiscard]] size_t GetChromaWidth() const noexcept { return (mGridCanvasContext.mWidth + 1) / 2; }
+
+        /**
+         * @brief YUV420 U, V 평면의 세로 픽셀 수 ((height + 1) / 2)
+         */
+        [[nodiscard]] size_t GetChromaHeight() const noexcept { return (mGridCanvasContext.mHeight + 1) / 2; }
+
         /**
          * @brief 버퍼 전체를 지정된 색상으로 클리어
          * @param color COLORREF (R, G, B) 값으로 채울 색상
+         * @details
+         * - Clear(), DrawGrid(), DrawWorm()은 YUV420의 U, V 평면을 갱신하지 않음 (Render()만 갱신)
+         * - Indexed8에서는 Create() 또는 Render()가 팔레트에 등록한 색상만 그릴 수 있음
          */
         void Clear(const COLORREF color) const;
 
@@ -73,6 +140,34 @@ namespace CoTigraphy
          */
         void DrawWorm(const Worm& worm) const;
 
+        /**
+         * @brief 현재 Grid/Worm 상태로 프레임을 갱신
+         * @param grid Grid 정보 객체
+         * @param worm 직전에 Move()가 성공한 Worm 객체
+         * @return 성공 시 Succeeded, Indexed8 팔레트에 256색을 넘는 색상이 필요하면 PaletteOverflow
+         * @details
+         * - Create()/Invalidate() 이후 첫 호출은 배경 + 그리드 레이어를 만들고, 레이어 복사 후 지렁이를 그림
+         * - 이후에는 worm.GetDirtyCells()의 셀만 레이어에 다시 칠해 프레임으로 복사하고, 그 셀 위의 지렁이 구간을 다시 그림
+         * - 셀과 지렁이 구간은 셀 영역 밖을 칠하지 않으므로 여백(배경)은 다시 그릴 필요가 없음
+         * - Indexed8은 그리기 전에 RegisterCellPalette()로 필요한 색상을 등록하므로 그리는 동안 팔레트는 읽기만 함
+         */
+        [[nodiscard]] Error Render(_In_ const Grid& grid, _In_ const Worm& worm);
+
+        /**
+         * @brief 다음 Render() 호출이 배경 + 그리드 레이어와 전체 프레임을 다시 그리도록 표시
+         */
+        void Invalidate() noexcept
+        {
+            mIsLayerValid = false;
+            mIsFrameValid = false;
+        }
+
+        /**
+         * @brief 마지막 Render()에서 바뀐 픽셀을 모두 포함하는 영역을 반환
+         * @return 변경 영역 (전체를 다시 그렸으면 캔버스 전체, 바뀐 셀이 없으면 빈 RECT)
+         */
+        [[nodiscard]] RECT GetDirtyRect() const noexcept { return mDirtyRect; }
+
     private:
         /**
          * @brief 지정된 위치에 하나의 셀을 정사각형 형태로 그림
@@ -83,38 +178,208 @@ namespace CoTigraphy
         void DrawCell(_In_ const size_t& week, _In_ const size_t& day, _In_ const COLORREF color) const;
 
         /**
-         * @brief 지정된 위치(y, x)에 스케일 적용된 셀을 RGBA 색상으로 그립니다.
+         * @brief 지정된 위치(y, x)에 스케일 적용된 셀을 지정한 색상으로 그립니다.
          * @param week 열 인덱스 (주)
          * @param day 행 인덱스 (요일)
          * @param scale 셀 크기 조절 비율 (0.0f ~ 1.0f)
          * @param color COLORREF 형식의 색상 (RGB)
-         * @pre y < mGridCanvasContext.mHeight
-         * @pre x < mGridCanvasContext.mWidth
          * @pre scale > 0.0f && scale <= 1.0f
          * @details
-         * - RECT 좌표를 계산 후, 실제 캔버스 크기를 초과하지 않도록 Clamp 처리함.
-         * - RGBA 4바이트 버퍼에 직접 픽셀 색상 정보를 저장하여 렌더링 성능 최적화.
-         * - RECT 내부 픽셀을 순회하며 지정된 색상으로 칠함.
+         * - DrawTile()로 프레임 버퍼에 그림
          */
         void DrawCellWithScale(_In_ const size_t& week, _In_ const size_t& day, _In_ const float scale,
                                _In_ const COLORREF color) const;
 
+        /**
+         * @brief 캔버스 전체 영역을 반환
+         */
+        [[nodiscard]] RECT GetCanvasRect() const noexcept;
+
+        /**
+         * @brief 배경 + 그리드 레이어 전체를 그림
+         * @param grid Grid 정보 객체
+         */
+        void DrawLayer(_In_ const Grid& grid) const;
+
+        /**
+         * @brief 레이어 전체를 복사하고 지렁이를 그려 프레임을 완성
+         * @param worm Worm 정보 객체
+         */
+        void DrawFrame(_In_ const Worm& worm) const;
+
+        /**
+         * @brief 셀 타일을 대상 버퍼의 셀 위치에 줄 단위로 복사
+         * @param target mBuffer 또는 mLayer
+         * @param week 열 인덱스 (주)
+         * @param day 행 인덱스 (요일)
+         * @param scale 셀 크기 조절 비율 (0.0f ~ 1.0f)
+         * @param color COLORREF 형식의 색상 (RGB)
+         * @param clipRect 그릴 수 있는 영역 (캔버스 전체)
+         * @details
+         * - clipRect 밖으로 나가는 부분은 잘라냄
+         * - 타일에 덮는 비율이 있으면 PixelKernels::BlendSpan()으로 대상 픽셀 위에 섞음
+         * - YUV420에서 섞인 픽셀의 Y는 Y 평면끼리 섞지 않고 섞인 R, G, B로 다시 계산 (U, V와 같은 색 기준)
+         */
+        void DrawTile(_In_ uint8_t* const target, _In_ const size_t week, _In_ const size_t day, _In_ const float scale,
+                      _In_ const COLORREF color, _In_ const RECT& clipRect) const;
+
+        /**
+         * @brief 이 캔버스 형식의 타일을 반환
+         * @param color 셀 색상
+         * @param scale 셀 크기 조절 비율
+         * @details
+         * - 한 번 조회한 타일은 mTiles에 보관해 이후에는 TileCache의 잠금 없이 찾음 (공유 캐시가 비워져도 유효)
+         * - TileCache에는 GetThemeColor()로 바꾼 색상의 타일을 요청 (mTiles는 원래 색상으로 찾음)
+         */
+        [[nodiscard]] const CellTile& GetTile(_In_ const COLORREF color, _In_ const float scale) const;
+
+        /**
+         * @brief GridCanvasContext::mColorTable에 따라 실제로 그릴 색상을 반환
+         * @param color Grid/Worm의 원래 색상
+         * @return 변환표에 있으면 바꾼 색상, 없으면 color
+         */
+        [[nodiscard]] COLORREF GetThemeColor(_In_ const COLORREF color) const noexcept;
+
+        /**
+         * @brief Create()에서 미리 계산한 원래 크기 셀의 RECT를 반환
+         * @param week 열 인덱스 (주 단위)
+         * @param day 행 인덱스 (요일)
+         * @return GetRect(week, day, 1.0f)와 같은 영역
+         */
+        [[nodiscard]] const RECT& GetCellRect(_In_ const size_t& week, _In_ const size_t& day) const;
+
+        /**
+         * @brief 대상 버퍼의 사각형 영역을 한 색상으로 채움
+         * @param target mBuffer 또는 mLayer
+         * @param rect 채울 영역 (캔버스 밖은 잘라냄)
+         * @param color COLORREF 형식의 색상 (RGB)
+         * @details
+         * - 32bit 형식은 PixelKernels::FillRect()로 첫 줄만 채우고 나머지 줄은 복사
+         * - YUV420은 Y 평면을 PixelKernels::ToLuma() 값으로, R, G, B 작업 평면을 각 채널 값으로 채움
+         * - Indexed8은 색상의 팔레트 번호로 채움
+         */
+        void FillRect(_In_ uint8_t* const target, _In_ const RECT& rect, _In_ const COLORREF color) const;
+
+        /**
+         * @brief 색상의 Indexed8 팔레트 번호를 반환
+         * @param color COLORREF 형식의 색상 (RGB)
+         * @pre 팔레트에 등록된 색상이어야 함
+         */
+        [[nodiscard]] uint8_t GetPaletteIndex(_In_ const COLORREF color) const;
+
+        /**
+         * @brief Grid/Worm의 원래 색상으로 그릴 색상과 그 팔레트 번호를 반환
+         * @param color Grid/Worm의 원래 색상
+         * @return (GetThemeColor(color), 그 색상의 팔레트 번호)
+         * @pre RegisterTilePalette()로 등록된 색상이어야 함
+         * @details
+         * - 셀마다 색상 변환표를 훑고 팔레트를 다시 찾지 않도록 등록할 때 기록해 둔 값을 사용
+         */
+        [[nodiscard]] const std::pair<COLORREF, uint8_t>& GetThemedPaletteIndex(_In_ const COLORREF color) const;
+
+        /**
+         * @brief 팔레트 번호로 칠한 한 줄 위에 color를 덮는 비율만큼 섞음
+         * @param target 대상 줄의 첫 팔레트 번호
+         * @param coverage 픽셀마다 덮는 비율 (0 ~ 255)
+         * @param count 픽셀 수
+         * @param color 섞을 색상 (COLORREF)
+         * @details
+         * - 팔레트 색상을 ARGB로 꺼내 PixelKernels::BlendSpan()으로 섞은 뒤 결과 색상의 번호를 다시 찾음 (32bit 형식과 같은 결과)
+         * - 섞은 색상은 RegisterTilePalette()가 미리 등록해 둠
+         */
+        void BlendIndexedSpan(_Inout_ uint8_t* target, _In_ const uint8_t* coverage, _In_ size_t count,
+                              _In_ const COLORREF color) const;
+
+        /**
+         * @brief 등록된 ARGB 색상의 팔레트 번호를 찾음
+         * @pre 팔레트에 등록된 색상이어야 함
+         * @details
+         * - 팔레트를 바꾸지 않으므로 그리는 함수(const)에서 호출할 수 있음
+         */
+        [[nodiscard]] uint8_t FindPaletteIndex(_In_ const uint32_t argb) const;
+
+        /**
+         * @brief ARGB 색상의 팔레트 번호를 찾거나 팔레트 끝에 추가
+         * @param argb 등록할 색상
+         * @param paletteIndex 색상의 팔레트 번호
+         * @return 팔레트가 가득 차 추가할 수 없으면 false
+         */
+        [[nodiscard]] bool AddPaletteColor(_In_ const uint32_t argb, _Out_ uint8_t& paletteIndex);
+
+        /**
+         * @brief 셀 하나를 그릴 때 만들어지는 Indexed8 색상을 팔레트에 등록
+         * @param grid Grid 정보 객체
+         * @param worm Worm 정보 객체
+         * @param week 열 인덱스 (주)
+         * @param day 행 인덱스 (요일)
+         * @param includeWorm 셀 위의 지렁이 구간까지 겹쳐 칠할지 여부
+         * @return 팔레트가 가득 차면 false
+         * @details
+         * - mPaletteScratch에 배경 -> 셀 -> 지렁이 구간을 Render()와 같은 순서로 칠하며 섞은 가장자리 색상까지 등록
+         * - 호출 순서가 정해져 있으므로 팔레트 번호는 그리는 순서와 관계없이 같음
+         */
+        [[nodiscard]] bool RegisterCellPalette(_In_ const Grid& grid, _In_ const Worm& worm, _In_ size_t week,
+                                               _In_ size_t day, _In_ bool includeWorm);
+
+        /**
+         * @brief mPaletteScratch 위에 타일을 칠하며 만들어지는 색상을 팔레트에 등록
+         * @param cellTile 칠할 타일 (GetTile())
+         * @param color 셀의 원래 색상 (GetThemeColor()로 바꿔 칠함)
+         * @return 팔레트가 가득 차면 false
+         */
+        [[nodiscard]] bool RegisterTilePalette(_In_ const CellTile& cellTile, _In_ const COLORREF color);
+
+        /**
+         * @brief 배경 + 그리드 레이어의 사각형 영역을 프레임 버퍼로 복사
+         * @param rect 복사할 영역
+         * @pre rect가 캔버스 내부에 있어야 함
+         */
+        void CopyRectFromLayer(_In_ const RECT& rect) const;
+
+        /**
+         * @brief YUV420에서 영역과 겹치는 2×2 블록의 U, V 값을 R, G, B 작업 평면으로 다시 계산
+         * @param rect 다시 계산할 영역 (ARGB이면 아무것도 하지 않음)
+         * @details
+         * - 오른쪽/아래쪽이 홀수인 마지막 블록은 rect 안의 픽셀을 반복해 평균
+         * - 따라서 libwebp가 왼쪽/위쪽을 짝수로 내린 rect 영역만 잘라 변환한 결과와 같음 (WebPMuxWriter의 부분 프레임)
+         */
+        void ResolveChroma(_In_ const RECT& rect) const;
+
         /**
          * @brief 스케일 적용 셀의 RECT 좌표 영역을 계산
          * @param week 열 인덱스 (주 단위)
          * @param day 행 인덱스 (요일)
          * @param scale 셀 크기 비율
-         * @return 해당 셀의 픽셀 영역 (RECT)
+         * @return 해당 셀의 출력 픽셀 영역 (논리 좌표 × mScale)
          */
         [[nodiscard]] RECT GetRect(_In_ const size_t& week, _In_ const size_t& day, _In_ const float scale) const;
 
     private:
-        const size_t mBytesPerPixel = 4; // RGBA 4개 채널
-        const size_t mAlignmentBits = mBytesPerPixel * CHAR_BIT; // 32 bit
+        const size_t mAlignmentBits = 4 * CHAR_BIT; // 32 bit
 
         GridCanvasContext mGridCanvasContext; // 현재 캔버스 구성 정보 
 
+        size_t mBytesPerPixel = 4; // 평면 하나의 픽셀 크기 (ARGB: 4, YUV420/Indexed8: 1)
+        size_t mPlaneCount = 1; // 칠하는 평면 수 (ARGB/Indexed8: 1, YUV420: Y + R, G, B 작업 평면 = 4)
+        std::array<size_t, 4> mPlaneOffsets{}; // 칠하는 평면의 버퍼 내 시작 위치
+        size_t mFrameSize = 0; // GetBuffer()로 넘기는 프레임 데이터 크기 (YUV420은 작업 평면 제외, Indexed8은 팔레트 포함)
         size_t mBufferSize = 0; // 전체 버퍼 크기
-        uint8_t* mBuffer = nullptr; // RGBA 버퍼 포인터
+        size_t mBufferCapacity = 0; // 할당된 버퍼 크기 (재사용 판단용)
+        uint8_t* mBuffer = nullptr; // 픽셀 버퍼 포인터
+        uint8_t* mLayer = nullptr; // 배경 + 그리드 레이어 (mBuffer와 같은 형식/크기, YUV420은 칠하는 평면만 사용)
+
+        size_t mWeekCapacity = 0; // 캔버스에 들어가는 열 수
+        size_t mDayCapacity = 0; // 캔버스에 들어가는 행 수
+        std::vector<RECT> mCellRects; // 원래 크기 셀의 RECT (week * mDayCapacity + day)
+        mutable std::vector<std::pair<TileKey, std::shared_ptr<const CellTile>>> mTiles; // 이 캔버스가 사용한 공유 타일 (Create()마다 비움)
+
+        std::unordered_map<uint32_t, uint8_t> mPaletteIndices; // ARGB 색상 -> 팔레트 번호
+        std::unordered_map<COLORREF, std::pair<COLORREF, uint8_t>> mThemedPaletteIndices; // 원래 색상 -> (그릴 색상, 팔레트 번호)
+        size_t mPaletteCount = 0; // 등록된 팔레트 색상 수
+        std::vector<uint8_t> mPaletteScratch; // 팔레트 등록용 셀 하나 크기의 팔레트 번호 버퍼 (RegisterCellPalette())
+
+        bool mIsLayerValid = false; // 레이어가 현재 Grid 상태와 같은지 여부
+        bool mIsFrameValid = false; // 버퍼에 이전 프레임이 온전히 남아 있는지 여부
+        RECT mDirtyRect{}; // 마지막 Render()의 변경 영역
     };
 } // CoTigraphy
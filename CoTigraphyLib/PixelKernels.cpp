@@ -0,0 +1,169 @@
+﻿// \file PixelKernels.cpp
+// \last_updated 2026-10-16
+// \author Oh Sungsik <ohsungsik@outlook.com>
+// \copyright (C) 2025. Oh Sungsik. All rights reserved.
+
+#include "pch.hpp"
+#include "PixelKernels.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace CoTigraphy
+{
+    namespace
+    {
+        /**
+         * @brief chroma 평균에 사용하는 감마 변환 표 (libwebp picture_csp_enc.c의 표와 같은 값)
+         */
+        struct GammaTables
+        {
+            static constexpr double mGamma = 0.80;
+            static constexpr int mLinearBits = 12; // 선형 값의 고정소수점 비트 수
+            static constexpr int mTableBits = 7; // 보간 표의 소수 비트 수
+            static constexpr int mLinearScale = (1 << mLinearBits) - 1;
+            static constexpr int mTableSize = 1 << (mLinearBits - mTableBits);
+
+            std::array<uint16_t, 256> mGammaToLinear{};
+            std::array<int, mTableSize + 1> mLinearToGamma{};
+
+            GammaTables() noexcept
+            {
+                const double norm = 1. / 255.;
+                for (size_t value = 0; value < mGammaToLinear.size(); ++value)
+                    mGammaToLinear[value] = static_cast<uint16_t>(
+                        std::pow(norm * static_cast<double>(value), mGamma) * mLinearScale + .5);
+
+                const double scale = static_cast<double>(1 << mTableBits) / mLinearScale;
+                for (size_t value = 0; value < mLinearToGamma.size(); ++value)
+                    mLinearToGamma[value] = static_cast<int>(
+                        255. * std::pow(scale * static_cast<double>(value), 1. / mGamma) + .5);
+            }
+
+            /**
+             * @brief 네 픽셀의 선형 값 합을 U, V 계산에 쓰는 (네 배 크기의) 감마 값으로 되돌림
+             */
+            [[nodiscard]] int ToGamma(_In_ const int linearSum) const noexcept
+            {
+                constexpr int fractionMask = (1 << (mTableBits + 2)) - 1;
+
+                const int position = linearSum >> (mTableBits + 2);
+                const int fraction = linearSum & fractionMask;
+                const int interpolated = mLinearToGamma[position + 1] * fraction +
+                    mLinearToGamma[position] * ((1 << (mTableBits + 2)) - fraction);
+                return (interpolated + (1 << mTableBits >> 1)) >> mTableBits;
+            }
+        };
+
+        const GammaTables& GetGammaTables() noexcept
+        {
+            static const GammaTables gammaTables;
+            return gammaTables;
+        }
+
+        // libwebp VP8ClipUV: 네 픽셀 합 기준(YUV_FIX + 2 비트)의 U/V를 [0, 255]로 변환
+        uint8_t ClipChroma(_In_ const int chroma) noexcept
+        {
+            constexpr int fixBits = 16 + 2;
+
+            const int value = (chroma + (1 << (fixBits - 1)) + (128 << fixBits)) >> fixBits;
+            return static_cast<uint8_t>(std::clamp(value, 0, 255));
+        }
+    }
+
+    ChromaPixel PixelKernels::ToChroma(_In_ const std::array<COLORREF, 4>& block) noexcept
+    {
+        const GammaTables& gammaTables = GetGammaTables();
+
+        int redSum = 0;
+        int greenSum = 0;
+        int blueSum = 0;
+        for (const COLORREF color : block)
+        {
+            redSum += gammaTables.mGammaToLinear[GetRValue(color)];
+            greenSum += gammaTables.mGammaToLinear[GetGValue(color)];
+            blueSum += gammaTables.mGammaToLinear[GetBValue(color)];
+        }
+
+        const int red = gammaTables.ToGamma(redSum);
+        const int green = gammaTables.ToGamma(greenSum);
+        const int blue = gammaTables.ToGamma(blueSum);
+
+        ChromaPixel chromaPixel;
+        chromaPixel.mU = ClipChroma(-9719 * red - 19081 * green + 28800 * blue);
+        chromaPixel.mV = ClipChroma(28800 * red - 24116 * green - 4684 * blue);
+        return chromaPixel;
+    }
+
+    void PixelKernels::FillSpan(_Out_writes_(count) uint32_t* target, _In_ const size_t count,
+                                _In_ const uint32_t pixel) noexcept
+    {
+        std::fill_n(target, count, pixel);
+    }
+
+    void PixelKernels::FillRect(_Out_ uint8_t* origin, _In_ const size_t stride, _In_ const size_t width,
+                                _In_ const size_t height, _In_ const uint32_t pixel) noexcept
+    {
+        if (height == 0)
+            return;
+
+        // 첫 줄만 채우고, 나머지 줄은 첫 줄을 복사 (memcpy가 CPU에 맞는 가장 넓은 복사를 사용)
+        FillSpan(reinterpret_cast<uint32_t*>(origin), width, pixel);
+
+        const size_t spanBytes = width * sizeof(uint32_t);
+        for (size_t row = 1; row < height; ++row)
+            memcpy(origin + row * stride, origin, spanBytes);
+    }
+
+    void PixelKernels::ExpandIndexedSpan(_Out_writes_(count) uint32_t* target, _In_ const uint8_t* indices,
+                                         _In_ const size_t count, _In_ const uint32_t* palette) noexcept
+    {
+        // 팔레트(1KB)는 L1 캐시에 머무르므로 픽셀마다 표 조회 한 번
+        for (size_t pixel = 0; pixel < count; ++pixel)
+            target[pixel] = palette[indices[pixel]];
+    }
+
+    void PixelKernels::UpscaleSpan(_Out_ uint8_t* target, _In_ const uint8_t* source, _In_ const size_t pixelCount,
+                                   _In_ const size_t bytesPerPixel, _In_ const size_t scale) noexcept
+    {
+        ASSERT(bytesPerPixel == 1 || bytesPerPixel == 4);
+
+        if (bytesPerPixel == 1)
+        {
+            for (size_t pixel = 0; pixel < pixelCount; ++pixel, target += scale)
+                memset(target, source[pixel], scale);
+            return;
+        }
+
+        for (size_t pixel = 0; pixel < pixelCount; ++pixel, target += scale * bytesPerPixel)
+        {
+            uint32_t value = 0;
+            memcpy(&value, source + pixel * bytesPerPixel, sizeof(value));
+            FillSpan(reinterpret_cast<uint32_t*>(target), scale, value);
+        }
+    }
+
+    void PixelKernels::BlendSpan(_Inout_ uint8_t* target, _In_ const uint8_t* source, _In_ const uint8_t* coverage,
+                                 _In_ const size_t pixelCount, _In_ const size_t bytesPerPixel) noexcept
+    {
+        for (size_t pixel = 0; pixel < pixelCount; ++pixel, target += bytesPerPixel, source += bytesPerPixel)
+        {
+            const uint32_t alpha = coverage[pixel];
+            if (alpha == 0)
+                continue;
+
+            if (alpha == 255)
+            {
+                memcpy(target, source, bytesPerPixel);
+                continue;
+            }
+
+            // (x + 128) × 257 >> 16 == round(x / 255) (x <= 255 × 255)
+            for (size_t channel = 0; channel < bytesPerPixel; ++channel)
+            {
+                const uint32_t mixed = source[channel] * alpha + target[channel] * (255 - alpha) + 128;
+                target[channel] = static_cast<uint8_t>((mixed * 257) >> 16);
+            }
+        }
+    }
+} // CoTigraphy
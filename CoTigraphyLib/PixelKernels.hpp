@@ -0,0 +1,152 @@
+﻿// \file PixelKernels.hpp
+// \last_updated 2026-10-16
+// \author Oh Sungsik <ohsungsik@outlook.com>
+// \copyright (C) 2025. Oh Sungsik. All rights reserved.
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+namespace CoTigraphy
+{
+    /**
+     * @brief 캔버스 버퍼의 픽셀 형식
+     */
+    enum class ePixelFormat
+    {
+        ARGB, // uint32 0xAARRGGBB (WebPPicture::argb 형식, 무손실 WebPMuxWriter가 복사 없이 인코더에 전달)
+        YUV420, // Y 평면(가로 × 세로) 뒤에 U, V 평면(각각 가로/2 × 세로/2, 올림) (손실 인코딩 WebPPicture의 y/u/v 형식)
+        Indexed8, // 픽셀마다 팔레트 번호 1바이트(가로 × 세로) 뒤에 ARGB 팔레트 256색 (PixelKernels::GetPaletteOffset())
+    };
+
+    /**
+     * @brief YUV420 2×2 블록 하나의 U, V 값 (BT.601 limited range)
+     */
+    struct ChromaPixel
+    {
+        uint8_t mU = 0; // 파랑 색차 [16, 240]
+        uint8_t mV = 0; // 빨강 색차 [16, 240]
+    };
+
+    /**
+     * @brief 캔버스 픽셀을 채우고, 섞고, 변환하는 함수 모음
+     * @details
+     * - 채우기는 FillRect()의 줄 복사(memcpy)가 대부분이라 첫 줄은 스칼라로 채움 (SSE2/NEON/AVX2 커널과 차이가 측정 오차 이내)
+     */
+    class PixelKernels final
+    {
+    public:
+        explicit PixelKernels() noexcept = delete;
+        PixelKernels(const PixelKernels& other) = delete;
+        PixelKernels(PixelKernels&& other) = delete;
+
+        PixelKernels& operator=(const PixelKernels& rhs) = delete;
+        PixelKernels& operator=(PixelKernels&& rhs) = delete;
+
+        ~PixelKernels() = delete;
+
+        /**
+         * @brief COLORREF를 불투명한 ARGB 픽셀 값으로 변환 (ARGB 캔버스와 Indexed8 팔레트 색상)
+         * @param color COLORREF (0x00BBGGRR)
+         * @return 0xFFRRGGBB
+         */
+        [[nodiscard]] static constexpr uint32_t ToPixel(_In_ const COLORREF color) noexcept
+        {
+            return 0xFF000000u | (static_cast<uint32_t>(GetRValue(color)) << 16) |
+                (static_cast<uint32_t>(GetGValue(color)) << 8) | static_cast<uint32_t>(GetBValue(color));
+        }
+
+        /**
+         * @brief Indexed8 버퍼에서 팔레트가 시작하는 위치를 계산
+         * @param pixelCount 가로 × 세로 픽셀 수
+         * @return 팔레트 시작 바이트 위치 (uint32 접근을 위해 16바이트 단위로 올림)
+         */
+        [[nodiscard]] static constexpr size_t GetPaletteOffset(_In_ const size_t pixelCount) noexcept
+        {
+            return (pixelCount + 15) & ~static_cast<size_t>(15);
+        }
+
+        /**
+         * @brief Indexed8 팔레트의 최대 색상 수
+         */
+        static constexpr size_t mPaletteCapacity = 256;
+
+        /**
+         * @brief COLORREF의 Y(밝기) 값을 계산
+         * @param color COLORREF (0x00BBGGRR)
+         * @return BT.601 limited range [16, 235] (libwebp VP8RGBToY와 같은 16bit 고정소수점 계수와 반올림)
+         */
+        [[nodiscard]] static constexpr uint8_t ToLuma(_In_ const COLORREF color) noexcept
+        {
+            constexpr int fixBits = 16;
+
+            const int luma = 16839 * GetRValue(color) + 33059 * GetGValue(color) + 6420 * GetBValue(color);
+            return static_cast<uint8_t>((luma + (1 << (fixBits - 1)) + (16 << fixBits)) >> fixBits);
+        }
+
+        /**
+         * @brief 2×2 블록 네 픽셀의 평균 U, V 값을 계산
+         * @param block 블록의 네 픽셀 (순서 무관, 캔버스 밖 픽셀은 안쪽 픽셀을 반복해 채움)
+         * @details
+         * - libwebp의 RGB -> YUV420 변환(WebPPictureARGBToYUVA)과 같은 감마 보정 평균과 계수를 사용하므로 결과가 같음
+         */
+        [[nodiscard]] static ChromaPixel ToChroma(_In_ const std::array<COLORREF, 4>& block) noexcept;
+
+        /**
+         * @brief 연속된 픽셀 count개를 한 값으로 채움
+         * @param target 채울 첫 픽셀
+         * @param count 픽셀 수
+         * @param pixel 채울 값 (ToPixel() 결과)
+         */
+        static void FillSpan(_Out_writes_(count) uint32_t* target, _In_ size_t count, _In_ uint32_t pixel) noexcept;
+
+        /**
+         * @brief 사각형 영역을 한 값으로 채움
+         * @details
+         * - 첫 줄만 FillSpan()으로 채우고 나머지 줄은 첫 줄을 memcpy로 복사 (줄마다 커널을 부르는 것보다 빠름)
+         * @param origin 영역의 왼쪽 위 픽셀
+         * @param stride 한 줄의 바이트 수
+         * @param width 영역의 가로 픽셀 수
+         * @param height 영역의 세로 픽셀 수
+         * @param pixel 채울 값 (ToPixel() 결과)
+         */
+        static void FillRect(_Out_ uint8_t* origin, _In_ size_t stride, _In_ size_t width, _In_ size_t height,
+                             _In_ uint32_t pixel) noexcept;
+
+        /**
+         * @brief 팔레트 번호를 ARGB 픽셀로 펼침 (인코딩 직전에만 사용)
+         * @param target 결과 ARGB 픽셀 (count개)
+         * @param indices 팔레트 번호
+         * @param count 픽셀 수
+         * @param palette ARGB 팔레트 (mPaletteCapacity개)
+         */
+        static void ExpandIndexedSpan(_Out_writes_(count) uint32_t* target, _In_ const uint8_t* indices,
+                                      _In_ size_t count, _In_ const uint32_t* palette) noexcept;
+
+        /**
+         * @brief 픽셀마다 scale개씩 가로로 반복해 복사 (정수배 확대의 한 줄)
+         * @param target 결과 (pixelCount × scale 픽셀)
+         * @param source 원본 픽셀
+         * @param pixelCount 원본 픽셀 수
+         * @param bytesPerPixel 픽셀 하나의 바이트 수 (4: FillSpan(), 1: memset)
+         * @param scale 확대 배율
+         * @pre bytesPerPixel == 1 || bytesPerPixel == 4
+         */
+        static void UpscaleSpan(_Out_ uint8_t* target, _In_ const uint8_t* source, _In_ size_t pixelCount,
+                                _In_ size_t bytesPerPixel, _In_ size_t scale) noexcept;
+
+        /**
+         * @brief 픽셀마다 덮는 비율만큼 source를 target 위에 섞음
+         * @param target 섞을 대상 픽셀 (결과가 저장됨)
+         * @param source 위에 올릴 픽셀
+         * @param coverage 픽셀마다 source가 덮는 비율 (0: target 유지, 255: source로 교체)
+         * @param pixelCount 픽셀 수
+         * @param bytesPerPixel 픽셀 하나의 바이트 수 (채널마다 같은 비율로 섞음)
+         * @details
+         * - 채널마다 (source × c + target × (255 - c)) / 255를 반올림한 고정소수점 정수 연산
+         */
+        static void BlendSpan(_Inout_ uint8_t* target, _In_ const uint8_t* source, _In_ const uint8_t* coverage,
+                              _In_ size_t pixelCount, _In_ size_t bytesPerPixel) noexcept;
+    };
+} // CoTigraphy
@@ -0,0 +1,45 @@
+﻿// \file RenderOptions.hpp
+// \last_updated 2026-10-16
+// \author Oh Sungsik <ohsungsik@outlook.com>
+// \copyright (C) 2025. Oh Sungsik. All rights reserved.
+
+#pragma once
+
+#include "ColorTheme.hpp"
+#include "EncodeOptions.hpp"
+#include "FrameTimeline.hpp"
+#include "FrameWriter.hpp"
+#include "RoutePlanner.hpp"
+
+namespace CoTigraphy
+{
+    /**
+     * @brief 출력 하나의 셀 크기와 간격 (--sizes 항목)
+     */
+    struct CellLayout
+    {
+        size_t mCellSize = 10; // 셀 한 변 길이 (논리 픽셀 단위)
+        size_t mCellMargin = 3; // 셀 간격 (논리 픽셀 단위)
+    };
+
+    /**
+     * @brief 렌더링 방식과 출력 형식을 결정하는 옵션 구조체
+     * @details
+     * - 명령줄에서 채워져 Renderer(배치 렌더링 시 모든 worker)에 전달됨
+     */
+    struct RenderOptions
+    {
+        eFrameWriterType mFrameWriterType = eFrameWriterType::AnimEncoder; // 애니메이션 출력 방식
+        EncodeOptions mEncodeOptions; // libwebp 인코딩 설정 (--encode_preset, --encode_options)
+        size_t mEncodeThreadCount = 0; // 프레임 구간별 병렬 인코딩 스레드 수 (0: 렌더링/인코딩 파이프라인 1개 사용, 1 이상과 파일은 다르고 프레임/시간은 같음)
+        eRouteStrategy mRouteStrategy = eRouteStrategy::Greedy; // 지렁이가 목표 셀을 먹는 순서를 정하는 방식
+        eTimeline mTimeline = eTimeline::Uniform; // 이벤트별 프레임 표시 시간 계산 방식
+        size_t mCellSize = 10; // 셀 한 변 길이 (논리 픽셀 단위)
+        size_t mCellMargin = 3; // 셀 간격 (논리 픽셀 단위)
+        size_t mCellRadius = 0; // 셀 모서리 반지름 (논리 픽셀 단위, 0: 직각, 가장자리는 anti-aliasing)
+        size_t mScale = 1; // 출력 배율 (논리 픽셀 하나를 N×N 출력 픽셀로 그림, HiDPI 화면용)
+        std::vector<size_t> mScales; // 한 번의 시뮬레이션으로 함께 출력할 배율 (비어 있으면 mScale 하나)
+        std::vector<CellLayout> mCellLayouts; // 한 번의 시뮬레이션으로 함께 출력할 셀 크기/간격 (비어 있으면 mCellSize/mCellMargin 하나)
+        std::vector<ColorTheme> mThemes; // 한 번의 시뮬레이션으로 함께 출력할 테마 (비어 있으면 API 색상 그대로 출력 1개)
+    };
+} // CoTigraphy
@@ -0,0 +1,341 @@
+﻿// \file Renderer.cpp
+// \last_updated 2026-10-16
+// \author Oh Sungsik <ohsungsik@outlook.com>
+// \copyright (C) 2025. Oh Sungsik. All rights reserved.
+
+#include "pch.hpp"
+#include "Renderer.hpp"
+
+#include <thread>
+
+#include "Worm.hpp"
+
+namespace CoTigraphy
+{
+    Renderer::Renderer() noexcept
+    = default;
+
+    Renderer::~Renderer()
+    = default;
+
+    void Renderer::Initialize(_In_ const std::wstring& githubToken, _In_ const RenderOptions& renderOptions)
+    {
+        mContributionCalendarClient.Initialize();
+
+        // 기록된 시뮬레이션만 렌더링하는 경우 token 없이 사용
+        if (githubToken.empty() == false)
+            mContributionCalendarClient.SetAccessToken(githubToken);
+
+        mRenderOptions = renderOptions;
+
+        // (테마 × 셀 크기 × 배율)마다 출력 1개, 테마가 없으면 API 색상 그대로, 목록이 없으면 mCellSize/mScale 하나
+        std::vector<const ColorTheme*> colorThemes;
+        for (const ColorTheme& colorTheme : mRenderOptions.mThemes)
+            colorThemes.push_back(&colorTheme);
+        if (colorThemes.empty())
+            colorThemes.push_back(nullptr);
+
+        const std::vector<size_t> scales = mRenderOptions.mScales.empty()
+                                               ? std::vector<size_t>{mRenderOptions.mScale}
+                                               : mRenderOptions.mScales;
+        std::vector<CellLayout> cellLayouts = mRenderOptions.mCellLayouts;
+        if (cellLayouts.empty())
+            cellLayouts.push_back({mRenderOptions.mCellSize, mRenderOptions.mCellMargin});
+
+        mRenderOutputs.clear();
+        for (const ColorTheme* const colorTheme : colorThemes)
+        {
+            for (const CellLayout& cellLayout : cellLayouts)
+            {
+                for (const size_t scale : scales)
+                {
+                    std::unique_ptr<RenderOutput> renderOutput = std::make_unique<RenderOutput>();
+                    renderOutput->mColorTheme = colorTheme;
+                    renderOutput->mCellLayout = cellLayout;
+                    renderOutput->mScale = scale;
+                    if (colorTheme != nullptr)
+                        renderOutput->mPathSuffix += L"-" + colorTheme->mName;
+                    if (mRenderOptions.mCellLayouts.empty() == false)
+                        renderOutput->mPathSuffix += L"-" + std::to_wstring(cellLayout.mCellSize) + L"px";
+                    if (mRenderOptions.mScales.empty() == false && scale != 1)
+                        renderOutput->mPathSuffix += L"@" + std::to_wstring(scale) + L"x";
+
+                    renderOutput->mFrameWriter = FrameWriter::Create(mRenderOptions.mFrameWriterType);
+                    POSTCONDITION(renderOutput->mFrameWriter != nullptr);
+                    renderOutput->mFrameWriter->SetEncodeOptions(mRenderOptions.mEncodeOptions);
+                    mRenderOutputs.emplace_back(std::move(renderOutput));
+                }
+            }
+        }
+
+        if (mRenderOptions.mEncodeThreadCount > 0)
+            mChunkedEncoder.Initialize(mRenderOptions.mFrameWriterType, mRenderOptions.mEncodeOptions,
+                                       mRenderOptions.mEncodeThreadCount);
+    }
+
+    void Renderer::Uninitialize()
+    {
+        mContributionCalendarClient.Uninitialize();
+    }
+
+    Error Renderer::Render(_In_ const std::wstring& userName, _In_ const std::wstring& outputPath)
+    {
+        const std::wstring reuiqredFields = L"date contributionCount color"; // 필요한 field
+        GridData gridData;
+        RETURN_IF_FAILED(mContributionCalendarClient.FetchContributionInfo(userName, reuiqredFields, gridData));
+
+        return RenderGridData(gridData, outputPath);
+    }
+
+    Error Renderer::RenderGridData(_In_ const GridData& gridData, _In_ const std::wstring& outputPath)
+    {
+        Simulate(gridData, mRenderOptions.mRouteStrategy, mSimulationLog);
+
+        return RenderSimulationLog(mSimulationLog, outputPath);
+    }
+
+    Error Renderer::RenderSimulationLog(_In_ const SimulationLog& simulationLog, _In_ const std::wstring& outputPath)
+    {
+        const GridData& gridData = simulationLog.GetGridData();
+
+        // 출력마다 같은 설정, 셀 크기/간격/배율/테마는 MakeOutputContext()가 출력별로 채움
+        GridCanvasContext context;
+        context.mCellRadius = mRenderOptions.mCellRadius;
+        context.mPixelFormat = mRenderOutputs.front()->mFrameWriter->GetPixelFormat(); // FrameWriter가 변환 없이 인코더에 넘김
+
+        // 벡터 출력은 이벤트를 SVG 애니메이션으로 옮기기만 하므로 캔버스/인코더를 사용하지 않음 (출력마다 차례로)
+        if (SvgWriter::IsSvgFileName(outputPath))
+        {
+            for (const std::unique_ptr<RenderOutput>& renderOutput : mRenderOutputs)
+            {
+                mSvgWriter.Write(simulationLog, MakeOutputContext(context, gridData.mWeekCount, *renderOutput),
+                                 mRenderOptions.mTimeline);
+                RETURN_IF_FAILED(mSvgWriter.SaveToFile(MakeOutputPath(outputPath, renderOutput->mPathSuffix)));
+            }
+            return MAKE_ERROR(eErrorCode::Succeeded);
+        }
+
+        // WebP 인코더가 만들 수 없는 크기는 인코더를 만들기 전에 거부 (기록 파일의 주 수는 명령줄에서 검사할 수 없음)
+        for (const std::unique_ptr<RenderOutput>& renderOutput : mRenderOutputs)
+        {
+            if (IsOutputSizeSupported(gridData.mWeekCount, renderOutput->mCellLayout.mCellSize,
+                                      renderOutput->mCellLayout.mCellMargin, renderOutput->mScale) == false)
+                return MAKE_ERROR(eErrorCode::InvalidArguments);
+        }
+
+        // 프레임 구간별로 나눠 여러 스레드에서 인코딩 (출력마다 차례로)
+        if (mRenderOptions.mEncodeThreadCount > 0)
+        {
+            for (const std::unique_ptr<RenderOutput>& renderOutput : mRenderOutputs)
+            {
+                RETURN_IF_FAILED(mChunkedEncoder.Encode(simulationLog,
+                                                        MakeOutputContext(context, gridData.mWeekCount, *renderOutput),
+                                                        mRenderOptions.mTimeline));
+                RETURN_IF_FAILED(mChunkedEncoder.SaveToFile(MakeOutputPath(outputPath, renderOutput->mPathSuffix)));
+            }
+            return MAKE_ERROR(eErrorCode::Succeeded);
+        }
+
+        Grid grid(gridData);
+        Worm worm(grid);
+
+        // writer 초기화 실패는 인코딩 스레드를 시작하기 전에 반환 (닫고 기다릴 파이프라인이 없음)
+        for (const std::unique_ptr<RenderOutput>& renderOutput : mRenderOutputs)
+        {
+            const GridCanvasContext outputContext = MakeOutputContext(context, gridData.mWeekCount, *renderOutput);
+
+            // 이전 작업의 버퍼가 충분히 크면 재할당하지 않음
+            renderOutput->mGridCanvas.Create(outputContext);
+            RETURN_IF_FAILED(renderOutput->mFrameWriter->Initialize(outputContext.mWidth, outputContext.mHeight));
+            renderOutput->mFramePipeline.Create(renderOutput->mGridCanvas.GetBufferSize(), mPipelineDepth);
+            SetRectEmpty(&renderOutput->mMergedDirtyRect);
+            renderOutput->mIsEncodeFailed = false;
+        }
+
+        // 인코딩은 출력마다 별도 스레드에서 수행하고, 이 스레드는 다음 프레임의 이벤트 재생/래스터화를 진행
+        std::vector<std::thread> encoders;
+        encoders.reserve(mRenderOutputs.size());
+        for (const std::unique_ptr<RenderOutput>& renderOutput : mRenderOutputs)
+            encoders.emplace_back(&Renderer::EncodeFrames, std::ref(*renderOutput));
+
+        const std::vector<SimulationEvent>& events = simulationLog.GetEvents();
+        FrameTimeline::Build(events, mRenderOptions.mTimeline, mFrameDurations);
+
+        // 이벤트는 한 번만 재생하고 출력마다 같은 변경 셀을 다시 그림
+        Error renderError = MAKE_ERROR(eErrorCode::Succeeded);
+        for (size_t eventIndex = 0; eventIndex < events.size() && renderError.IsSucceeded(); ++eventIndex)
+        {
+            worm.Apply(events[eventIndex]);
+            const int durationMs = mFrameDurations[eventIndex];
+
+            for (const std::unique_ptr<RenderOutput>& renderOutput : mRenderOutputs)
+            {
+                // 인코딩에 실패한 출력이 있으면 남은 프레임은 그리지 않음
+                if (renderOutput->mIsEncodeFailed)
+                {
+                    renderError = MAKE_ERROR(eErrorCode::EncodingFailure);
+                    break;
+                }
+
+                GridCanvas& gridCanvas = renderOutput->mGridCanvas;
+
+                // 첫 프레임만 전체를 그리고, 이후에는 지렁이가 지나간 셀만 다시 그림
+                renderError = gridCanvas.Render(grid, worm);
+                if (renderError.IsFailed())
+                    break;
+
+                // 앞 프레임에 합쳐진 이벤트는 캔버스에만 그리고, 변경 영역은 다음 프레임에 포함
+                const RECT dirtyRect = gridCanvas.GetDirtyRect();
+                UnionRect(&renderOutput->mMergedDirtyRect, &renderOutput->mMergedDirtyRect, &dirtyRect);
+                if (durationMs == 0)
+                    continue;
+
+                // 인코딩 스레드가 밀려 있으면 빈 프레임이 반환될 때까지 대기
+                PipelineFrame frame = renderOutput->mFramePipeline.AcquireFreeFrame();
+
+                // 버퍼는 마지막으로 채운 프레임을 갖고 있으므로 그 뒤에 바뀐 줄만 복사 (처음 쓰는 버퍼는 전체)
+                RECT copyRect;
+                UnionRect(&copyRect, &frame.mStaleRect, &renderOutput->mMergedDirtyRect);
+                gridCanvas.CopyFrameRows(frame.mBuffer, copyRect);
+                frame.mDirtyRect = renderOutput->mMergedDirtyRect;
+                frame.mDurationMs = durationMs;
+                renderOutput->mFramePipeline.PushFrame(frame);
+                SetRectEmpty(&renderOutput->mMergedDirtyRect);
+            }
+        }
+
+        for (const std::unique_ptr<RenderOutput>& renderOutput : mRenderOutputs)
+            renderOutput->mFramePipeline.Close();
+        for (std::thread& encoder : encoders)
+            encoder.join();
+
+        if (renderError.IsFailed())
+            return renderError;
+
+        // 마지막 프레임들은 파이프라인을 닫은 뒤에 인코딩되므로 join() 후 다시 확인
+        for (const std::unique_ptr<RenderOutput>& renderOutput : mRenderOutputs)
+        {
+            if (renderOutput->mIsEncodeFailed)
+                return MAKE_ERROR(eErrorCode::EncodingFailure);
+        }
+
+        for (const std::unique_ptr<RenderOutput>& renderOutput : mRenderOutputs)
+        {
+            const Error error = renderOutput->mFrameWriter->SaveToFile(
+                MakeOutputPath(outputPath, renderOutput->mPathSuffix));
+            if (error.IsFailed())
+                return error;
+        }
+
+        return MAKE_ERROR(eErrorCode::Succeeded);
+    }
+
+    std::wstring Renderer::MakeOutputPath(_In_ const std::wstring& outputPath, _In_ const std::wstring& suffix)
+    {
+        // 디렉터리 이름의 '.'은 확장자가 아님
+        const size_t fileNameBegin = outputPath.find_last_of(L"\\/");
+        size_t extensionBegin = outputPath.rfind(L'.');
+        if (extensionBegin == std::wstring::npos ||
+            (fileNameBegin != std::wstring::npos && extensionBegin < fileNameBegin))
+            extensionBegin = outputPath.size();
+
+        std::wstring outputVariantPath = outputPath.substr(0, extensionBegin);
+        outputVariantPath += suffix;
+        outputVariantPath += outputPath.substr(extensionBegin);
+        return outputVariantPath;
+    }
+
+    bool Renderer::IsOutputSizeSupported(_In_ const size_t weekCount, _In_ const size_t cellSize,
+                                         _In_ const size_t cellMargin, _In_ const size_t scale) noexcept
+    {
+        constexpr size_t maxDimension = WEBP_MAX_DIMENSION;
+        constexpr size_t daysPerWeek = 7;
+
+        if (weekCount == 0 || cellSize == 0 || scale == 0)
+            return false;
+
+        // 각 값이 최대 크기 이하이면 아래 계산은 overflow하지 않음
+        if (weekCount > maxDimension || cellSize > maxDimension || cellMargin > maxDimension || scale > maxDimension)
+            return false;
+
+        const size_t cellStride = cellSize + cellMargin;
+        const size_t logicalWidth = weekCount * cellStride - cellMargin;
+        const size_t logicalHeight = daysPerWeek * cellStride - cellMargin;
+        return logicalWidth <= maxDimension / scale && logicalHeight <= maxDimension / scale;
+    }
+
+    GridCanvasContext Renderer::MakeCanvasContext(_In_ const size_t weekCount, _In_ const CellLayout& cellLayout,
+                                                  _In_ const size_t scale) noexcept
+    {
+        constexpr size_t daysPerWeek = 7; // Sunday~Saturday (7 rows)
+        const size_t cellStride = cellLayout.mCellSize + cellLayout.mCellMargin;
+
+        // 배치는 논리 해상도에서 계산하고 크기만 정수배로 확대
+        GridCanvasContext context;
+        context.mWidth = (weekCount * cellStride - cellLayout.mCellMargin) * scale;
+        context.mHeight = (daysPerWeek * cellStride - cellLayout.mCellMargin) * scale;
+        context.mCellSize = cellLayout.mCellSize;
+        context.mCellMargin = cellLayout.mCellMargin;
+        context.mScale = scale;
+        return context;
+    }
+
+    GridCanvasContext Renderer::MakeOutputContext(_In_ const GridCanvasContext& context, _In_ const size_t weekCount,
+                                                  _In_ const RenderOutput& renderOutput)
+    {
+        const GridCanvasContext canvasContext = MakeCanvasContext(weekCount, renderOutput.mCellLayout,
+                                                                  renderOutput.mScale);
+
+        GridCanvasContext outputContext = context;
+        outputContext.mWidth = canvasContext.mWidth;
+        outputContext.mHeight = canvasContext.mHeight;
+        outputContext.mCellSize = canvasContext.mCellSize;
+        outputContext.mCellMargin = canvasContext.mCellMargin;
+        outputContext.mScale = canvasContext.mScale;
+
+        if (renderOutput.mColorTheme != nullptr)
+        {
+            outputContext.mBackgroundColor = renderOutput.mColorTheme->mBackgroundColor;
+            outputContext.mColorTable = renderOutput.mColorTheme->mColorTable;
+        }
+        return outputContext;
+    }
+
+    void Renderer::Simulate(_In_ const GridData& gridData, _In_ const eRouteStrategy routeStrategy,
+                            _Out_ SimulationLog& outSimulationLog)
+    {
+        outSimulationLog.Reset(gridData);
+
+        Grid grid(gridData);
+        Worm worm(grid);
+        worm.SetRouteStrategy(routeStrategy);
+
+        // 셀이 없는 레벨은 건너뛰고 남은 셀이 있는 레벨 사이를 바로 이동
+        uint64_t currentLevel = grid.GetNextContributionLevel(0);
+        while (currentLevel != 0 && currentLevel <= gridData.mMaxCount)
+        {
+            const bool ret = worm.Move(currentLevel);
+            if (ret == false)
+            {
+                currentLevel = grid.GetNextContributionLevel(currentLevel);
+                continue;
+            }
+
+            outSimulationLog.Record(worm.GetLastEvent());
+        }
+    }
+
+    void Renderer::EncodeFrames(_Inout_ RenderOutput& renderOutput)
+    {
+        PipelineFrame frame;
+        while (renderOutput.mFramePipeline.PopFrame(frame))
+        {
+            // 실패한 뒤에도 파이프라인이 닫힐 때까지 프레임을 꺼내 반환해야 래스터화 스레드가 빈 프레임을 기다리지 않음
+            if (renderOutput.mIsEncodeFailed == false &&
+                renderOutput.mFrameWriter->AddFrame(frame.mBuffer, frame.mDirtyRect, frame.mDurationMs) == false)
+                renderOutput.mIsEncodeFailed = true;
+
+            renderOutput.mFramePipeline.ReleaseFrame(frame);
+        }
+    }
+} // CoTigraphy
@@ -0,0 +1,189 @@
+﻿// \file Renderer.hpp
+// \last_updated 2026-10-16
+// \author Oh Sungsik <ohsungsik@outlook.com>
+// \copyright (C) 2025. Oh Sungsik. All rights reserved.
+
+#pragma once
+
+#include <atomic>
+
+#include "ChunkedEncoder.hpp"
+#include "FramePipeline.hpp"
+#include "FrameWriter.hpp"
+#include "GitHubContributionCalendarClient.hpp"
+#include "GridCanvas.hpp"
+#include "RenderOptions.hpp"
+#include "SimulationLog.hpp"
+#include "SvgWriter.hpp"
+
+namespace CoTigraphy
+{
+    /**
+     * @brief 한 사용자의 Contribution calendar를 WebP 애니메이션으로 렌더링하는 클래스
+     * @details
+     * - GitHub 클라이언트(curl 핸들), GridCanvas 버퍼, FrameWriter를 보유하고 여러 렌더링 작업에 걸쳐 재사용
+     * - 스레드 간 공유하지 않으며, 배치 렌더링 시 worker thread마다 하나씩 생성
+     * - Initialize -> Render 반복 -> Uninitialize 순으로 사용
+     * @pre GitHubContributionCalendarClient::GlobalInitialize() 이후에 사용
+     */
+    class Renderer final
+    {
+    public:
+        explicit Renderer() noexcept;
+        Renderer(const Renderer& other) = delete;
+        Renderer(Renderer&& other) = delete;
+
+        Renderer& operator=(const Renderer& rhs) = delete;
+        Renderer& operator=(Renderer&& rhs) = delete;
+
+        ~Renderer();
+
+        /**
+         * @brief GitHub 클라이언트를 초기화하고 access token을 설정
+         * @param githubToken GitHub Personal Access Token
+         * @param renderOptions 렌더링 옵션 (출력 writer 종류 등)
+         */
+        void Initialize(_In_ const std::wstring& githubToken, _In_ const RenderOptions& renderOptions);
+
+        /**
+         * @brief GitHub 클라이언트 리소스 해제
+         */
+        void Uninitialize();
+
+        /**
+         * @brief 사용자의 Contribution calendar를 가져와 WebP 애니메이션으로 저장
+         * @param userName GitHub 사용자 이름
+         * @param outputPath WebP 출력 경로
+         * @return 성공 시 Succeeded, 가져오기 실패 시 NetworkFailure 또는 InvalidContributionData, 그 외 실패 시 에러 코드
+         */
+        [[nodiscard]] Error Render(_In_ const std::wstring& userName, _In_ const std::wstring& outputPath);
+
+        /**
+         * @brief 이미 가져온 GridData로 Worm 시뮬레이션 후 WebP 애니메이션으로 저장
+         * @param gridData Contribution calendar 데이터
+         * @param outputPath WebP 출력 경로
+         * @return 성공 시 Succeeded, 실패 시 에러 코드
+         * @details
+         * - Simulate()로 이벤트를 기록한 뒤 RenderSimulationLog()로 렌더링
+         * - 기록된 이벤트는 GetSimulationLog()로 얻을 수 있음
+         */
+        [[nodiscard]] Error RenderGridData(_In_ const GridData& gridData, _In_ const std::wstring& outputPath);
+
+        /**
+         * @brief 기록된 시뮬레이션을 BFS 없이 재생하며 WebP 애니메이션으로 저장
+         * @param simulationLog 초기 Grid와 프레임별 이벤트
+         * @param outputPath WebP 출력 경로
+         * @return 성공 시 Succeeded, 실패 시 에러 코드
+         * @details
+         * - GridCanvas 버퍼, 프레임 큐, FrameWriter는 이전 작업의 것을 재사용
+         * - 호출 스레드가 이벤트 재생/래스터화를 수행하고, 별도의 인코딩 스레드가 FramePipeline에서 프레임을 꺼내 인코딩
+         * - RenderOptions::mThemes/mCellLayouts/mScales가 있으면 이벤트를 한 번 재생하며 (테마 × 셀 크기 × 배율)마다
+         *   캔버스를 그리고, 출력별 인코딩 스레드가 동시에 인코딩해 MakeOutputPath() 경로에 저장 (예: banner-dark-20px@2x.webp)
+         * - RenderOptions::mEncodeThreadCount가 0보다 크면 ChunkedEncoder로 프레임 구간별 병렬 인코딩 (출력은 차례로)
+         * - 프레임 표시 시간은 RenderOptions::mTimeline으로 FrameTimeline::Build()가 정하며, 시간이 0인 이벤트는
+         *   캔버스에만 그리고 프레임으로 인코딩하지 않음
+         * - outputPath의 확장자가 .svg이면 래스터화/인코딩 없이 출력마다 SvgWriter로 SVG 애니메이션을 저장
+         */
+        [[nodiscard]] Error RenderSimulationLog(_In_ const SimulationLog& simulationLog,
+                                                _In_ const std::wstring& outputPath);
+
+        /**
+         * @brief 출력 경로의 확장자 앞에 이름을 붙임
+         * @param outputPath 원래 출력 경로 (예: out/banner.webp)
+         * @param suffix 붙일 이름 (예: -dark@2x)
+         * @return 출력별 경로 (예: out/banner-dark@2x.webp)
+         */
+        [[nodiscard]] static std::wstring MakeOutputPath(_In_ const std::wstring& outputPath,
+                                                         _In_ const std::wstring& suffix);
+
+        /**
+         * @brief 출력 캔버스의 가로/세로가 WebP 최대 크기(WEBP_MAX_DIMENSION) 이하인지 확인
+         * @param weekCount Contribution calendar의 주 수
+         * @param cellSize 셀 한 변 길이 (논리 px)
+         * @param cellMargin 셀 간격 (논리 px, 0 허용)
+         * @param scale 출력 배율
+         * @return 출력 크기가 유효하면 true (0인 값, 크기 계산 중 overflow가 생기는 값이면 false)
+         * @details
+         * - 명령줄 파싱 시에는 주 수를 모르므로 mMaxCalendarWeekCount로 검사
+         */
+        [[nodiscard]] static bool IsOutputSizeSupported(_In_ const size_t weekCount, _In_ const size_t cellSize,
+                                                        _In_ const size_t cellMargin, _In_ const size_t scale) noexcept;
+
+        /**
+         * @brief 셀 배치와 배율로 캔버스 크기를 계산한 캔버스 구성 정보를 만듦 (나머지 항목은 기본값)
+         * @param weekCount Contribution calendar의 주 수
+         * @param cellLayout 셀 크기/간격 (논리 px)
+         * @param scale 출력 배율
+         * @pre IsOutputSizeSupported(weekCount, cellLayout.mCellSize, cellLayout.mCellMargin, scale)
+         */
+        [[nodiscard]] static GridCanvasContext MakeCanvasContext(_In_ size_t weekCount, _In_ const CellLayout& cellLayout,
+                                                                 _In_ size_t scale) noexcept;
+
+        /**
+         * @brief 마지막 RenderGridData()/Render()에서 기록한 시뮬레이션을 반환
+         */
+        [[nodiscard]] const SimulationLog& GetSimulationLog() const noexcept { return mSimulationLog; }
+
+        /**
+         * @brief Worm 시뮬레이션을 끝까지 수행하며 프레임별 이벤트를 기록
+         * @param gridData Contribution calendar 데이터
+         * @param routeStrategy 지렁이가 목표 셀을 먹는 순서를 정하는 방식
+         * @param outSimulationLog 기록 대상 (기존 내용은 지워짐)
+         * @details
+         * - 레벨 1부터 gridData.mMaxCount까지 Worm::Move()를 반복하며 이동할 때마다 이벤트 1개를 기록
+         * - 남은 셀이 없는 레벨은 Grid::GetNextContributionLevel()로 건너뜀
+         */
+        static void Simulate(_In_ const GridData& gridData, _In_ const eRouteStrategy routeStrategy,
+                             _Out_ SimulationLog& outSimulationLog);
+
+    private:
+        /**
+         * @brief 출력 파일 하나(테마 하나 × 셀 크기 하나 × 배율 하나)가 소유하는 리소스
+         */
+        struct RenderOutput
+        {
+            GridCanvas mGridCanvas; // 이 출력의 색상/셀 크기/배율로 그리는 캔버스
+            FramePipeline mFramePipeline; // 래스터화 -> 인코딩 스레드 프레임 큐
+            std::unique_ptr<FrameWriter> mFrameWriter; // 출력별 writer
+            const ColorTheme* mColorTheme = nullptr; // RenderOptions::mThemes의 테마 (nullptr: API 색상 그대로)
+            CellLayout mCellLayout; // 셀 크기/간격 (논리 px)
+            size_t mScale = 1; // 출력 배율
+            std::wstring mPathSuffix; // 출력 경로의 확장자 앞에 붙일 이름 (예: -dark-20px@2x)
+            RECT mMergedDirtyRect{}; // 앞 프레임에 합쳐져 아직 인코딩하지 않은 이벤트들의 변경 영역
+            std::atomic<bool> mIsEncodeFailed{false}; // 인코딩 스레드에서 FrameWriter::AddFrame()이 실패했는지 여부
+        };
+
+        /**
+         * @brief 인코딩 스레드 진입점, FramePipeline이 닫힐 때까지 프레임을 꺼내 FrameWriter에 추가
+         * @param renderOutput 이 스레드가 인코딩할 출력
+         * @details
+         * - AddFrame()이 실패하면 mIsEncodeFailed를 설정하고, 이후 프레임은 인코딩하지 않고 반환만 함 (래스터화 스레드가 막히지 않음)
+         */
+        static void EncodeFrames(_Inout_ RenderOutput& renderOutput);
+
+        /**
+         * @brief 출력마다 같은 캔버스 구성 정보에 출력의 셀 크기/간격, 배율, 테마(배경 색상, 색상 변환표)를 적용
+         * @param context 출력마다 같은 캔버스 구성 정보 (모서리 반지름, 픽셀 형식)
+         * @param weekCount Contribution calendar의 주 수
+         * @param renderOutput 대상 출력
+         */
+        [[nodiscard]] static GridCanvasContext MakeOutputContext(_In_ const GridCanvasContext& context,
+                                                                 _In_ size_t weekCount,
+                                                                 _In_ const RenderOutput& renderOutput);
+
+    public:
+        static constexpr size_t mMaxCalendarWeekCount = 54; // 1년치(최대 367일) calendar가 걸칠 수 있는 최대 주 수
+
+    private:
+        static constexpr size_t mPipelineDepth = 4; // 렌더링과 인코딩 사이에 대기할 수 있는 최대 프레임 수
+
+        GitHubContributionCalendarClient mContributionCalendarClient;
+        SimulationLog mSimulationLog; // 마지막 시뮬레이션 기록 (작업 간 재사용)
+        std::vector<int> mFrameDurations; // 이벤트별 프레임 표시 시간 (작업 간 재사용)
+
+        RenderOptions mRenderOptions;
+        std::vector<std::unique_ptr<RenderOutput>> mRenderOutputs; // (테마 × 셀 크기 × 배율)마다 하나 (옵션이 없으면 1개)
+        ChunkedEncoder mChunkedEncoder; // mEncodeThreadCount > 0일 때 사용
+        SvgWriter mSvgWriter; // 출력 경로가 .svg일 때 사용
+    };
+} // CoTigraphy
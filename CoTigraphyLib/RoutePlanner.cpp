@@ -0,0 +1,213 @@
+﻿// \file RoutePlanner.cpp
+// \last_updated 2026-10-16
+// \author Oh Sungsik <ohsungsik@outlook.com>
+// \copyright (C) 2025. Oh Sungsik. All rights reserved.
+
+#include "pch.hpp"
+#include "RoutePlanner.hpp"
+
+namespace CoTigraphy
+{
+    RoutePlanner::RoutePlanner() noexcept
+    = default;
+
+    RoutePlanner::~RoutePlanner()
+    = default;
+
+    void RoutePlanner::Plan(_In_ const POINT& start, _Inout_ std::vector<POINT>& targets)
+    {
+        mRoute.clear();
+        mRoute.push_back(start);
+        mRoute.insert(mRoute.end(), targets.begin(), targets.end());
+
+        BuildNearestNeighbourRoute();
+
+        // 더 이상 줄일 수 없거나 평가 횟수 제한에 도달할 때까지 개선
+        mRemainingEvaluations = mEvaluationBudget;
+        while (mRemainingEvaluations > 0)
+        {
+            const bool twoOptImproved = ImproveTwoOpt();
+            const bool orOptImproved = ImproveOrOpt();
+            if (twoOptImproved == false && orOptImproved == false)
+                break;
+        }
+
+        targets.assign(mRoute.begin() + 1, mRoute.end());
+    }
+
+    size_t RoutePlanner::GetRouteLength(_In_ const POINT& start, _In_ const std::vector<POINT>& targets)
+    {
+        size_t length = 0;
+        POINT current = start;
+        for (const POINT& target : targets)
+        {
+            length += GetDistance(current, target);
+            current = target;
+        }
+        return length;
+    }
+
+    size_t RoutePlanner::GetDistance(_In_ const POINT& lhs, _In_ const POINT& rhs) noexcept
+    {
+        return static_cast<size_t>(std::abs(lhs.x - rhs.x)) + static_cast<size_t>(std::abs(lhs.y - rhs.y));
+    }
+
+    void RoutePlanner::BuildNearestNeighbourRoute()
+    {
+        for (size_t position = 1; position < mRoute.size(); ++position)
+        {
+            const POINT& current = mRoute[position - 1];
+
+            size_t nearest = position;
+            size_t nearestDistance = GetDistance(current, mRoute[position]);
+            for (size_t candidate = position + 1; candidate < mRoute.size(); ++candidate)
+            {
+                const size_t distance = GetDistance(current, mRoute[candidate]);
+                if (distance < nearestDistance)
+                {
+                    nearest = candidate;
+                    nearestDistance = distance;
+                }
+            }
+
+            // 남은 셀의 상대 순서를 유지하며 가장 가까운 셀을 앞으로 가져옴
+            std::rotate(mRoute.begin() + static_cast<std::ptrdiff_t>(position),
+                        mRoute.begin() + static_cast<std::ptrdiff_t>(nearest),
+                        mRoute.begin() + static_cast<std::ptrdiff_t>(nearest) + 1);
+        }
+    }
+
+    bool RoutePlanner::ImproveTwoOpt()
+    {
+        const size_t last = mRoute.size() - 1;
+
+        bool improved = false;
+        for (size_t i = 1; i < last; ++i)
+        {
+            if (ConsumeEvaluations(last - i) == false)
+                break;
+
+            for (size_t j = i + 1; j <= last; ++j)
+            {
+                // mRoute[i..j]를 뒤집으면 (i-1, i), (j, j+1) 간선이 (i-1, j), (i, j+1)로 바뀜
+                size_t before = GetDistance(mRoute[i - 1], mRoute[i]);
+                size_t after = GetDistance(mRoute[i - 1], mRoute[j]);
+                if (j < last)
+                {
+                    before += GetDistance(mRoute[j], mRoute[j + 1]);
+                    after += GetDistance(mRoute[i], mRoute[j + 1]);
+                }
+
+                if (after < before)
+                {
+                    std::reverse(mRoute.begin() + static_cast<std::ptrdiff_t>(i),
+                                 mRoute.begin() + static_cast<std::ptrdiff_t>(j) + 1);
+                    improved = true;
+                }
+            }
+        }
+
+        return improved;
+    }
+
+    bool RoutePlanner::ImproveOrOpt()
+    {
+        const size_t last = mRoute.size() - 1;
+
+        bool improved = false;
+        for (size_t length = 1; length <= mMaxSegmentLength; ++length)
+        {
+            for (size_t first = 1; first + length - 1 <= last; ++first)
+            {
+                if (ConsumeEvaluations(last + 1) == false)
+                    return improved;
+
+                const size_t segmentLast = first + length - 1;
+                const POINT& previous = mRoute[first - 1];
+                const bool hasNext = segmentLast < last;
+
+                // 구간을 빼냈을 때 줄어드는 거리
+                int64_t removeGain = static_cast<int64_t>(GetDistance(previous, mRoute[first]));
+                if (hasNext)
+                {
+                    removeGain += static_cast<int64_t>(GetDistance(mRoute[segmentLast], mRoute[segmentLast + 1]));
+                    removeGain -= static_cast<int64_t>(GetDistance(previous, mRoute[segmentLast + 1]));
+                }
+
+                // mRoute[k]와 mRoute[k + 1] 사이에 넣었을 때 늘어나는 거리가 가장 작은 위치
+                size_t bestPosition = 0;
+                bool bestReversed = false;
+                int64_t bestInsertCost = removeGain;
+                for (size_t k = 0; k <= last; ++k)
+                {
+                    if (k + 1 >= first && k <= segmentLast)
+                        continue;
+
+                    int64_t forwardCost = static_cast<int64_t>(GetDistance(mRoute[k], mRoute[first]));
+                    int64_t reversedCost = static_cast<int64_t>(GetDistance(mRoute[k], mRoute[segmentLast]));
+                    if (k < last)
+                    {
+                        const int64_t removedEdge = static_cast<int64_t>(GetDistance(mRoute[k], mRoute[k + 1]));
+                        forwardCost += static_cast<int64_t>(GetDistance(mRoute[segmentLast], mRoute[k + 1])) - removedEdge;
+                        reversedCost += static_cast<int64_t>(GetDistance(mRoute[first], mRoute[k + 1])) - removedEdge;
+                    }
+
+                    if (forwardCost < bestInsertCost)
+                    {
+                        bestPosition = k;
+                        bestReversed = false;
+                        bestInsertCost = forwardCost;
+                    }
+                    if (reversedCost < bestInsertCost)
+                    {
+                        bestPosition = k;
+                        bestReversed = true;
+                        bestInsertCost = reversedCost;
+                    }
+                }
+
+                if (bestInsertCost >= removeGain)
+                    continue;
+
+                // 구간을 빼고 bestPosition 뒤에 다시 넣은 경로를 만듦
+                mScratch.clear();
+                for (size_t index = 0; index <= last; ++index)
+                {
+                    if (index >= first && index <= segmentLast)
+                        continue;
+
+                    mScratch.push_back(mRoute[index]);
+                    if (index != bestPosition)
+                        continue;
+
+                    if (bestReversed)
+                        mScratch.insert(mScratch.end(),
+                                        mRoute.rbegin() + static_cast<std::ptrdiff_t>(last - segmentLast),
+                                        mRoute.rbegin() + static_cast<std::ptrdiff_t>(last - first) + 1);
+                    else
+                        mScratch.insert(mScratch.end(),
+                                        mRoute.begin() + static_cast<std::ptrdiff_t>(first),
+                                        mRoute.begin() + static_cast<std::ptrdiff_t>(segmentLast) + 1);
+                }
+
+                ASSERT(mScratch.size() == mRoute.size());
+                mRoute.swap(mScratch);
+                improved = true;
+            }
+        }
+
+        return improved;
+    }
+
+    bool RoutePlanner::ConsumeEvaluations(_In_ const size_t count) noexcept
+    {
+        if (count > mRemainingEvaluations)
+        {
+            mRemainingEvaluations = 0;
+            return false;
+        }
+
+        mRemainingEvaluations -= count;
+        return true;
+    }
+} // CoTigraphy
@@ -0,0 +1,96 @@
+﻿// \file RoutePlanner.hpp
+// \last_updated 2026-10-16
+// \author Oh Sungsik <ohsungsik@outlook.com>
+// \copyright (C) 2025. Oh Sungsik. All rights reserved.
+
+#pragma once
+
+#include <vector>
+
+namespace CoTigraphy
+{
+    /**
+     * @brief 지렁이가 한 레벨의 목표 셀을 먹는 순서를 정하는 방식
+     */
+    enum class eRouteStrategy
+    {
+        Greedy, // 매번 BFS로 가장 가까운 목표 셀을 선택 (기본값)
+        Optimized, // 레벨마다 전체 방문 순서를 RoutePlanner로 계획
+    };
+
+    /**
+     * @brief 시작 위치에서 출발해 모든 목표 셀을 한 번씩 방문하는 짧은 순서를 계산하는 클래스
+     * @details
+     * - Grid에는 장애물이 없으므로 두 셀 사이 이동 횟수는 맨해튼 거리와 같음
+     * - 최근접 이웃(nearest neighbour)으로 초기 순서를 만든 뒤 2-opt, Or-opt로 개선
+     * - 돌아오지 않는 경로(open path)이며, 시작 위치는 고정
+     * - 개선은 더 이상 줄일 수 없거나 후보 평가 횟수가 mEvaluationBudget에 도달하면 중단 (실행 환경과 관계없이 결과는 항상 같음)
+     */
+    class RoutePlanner final
+    {
+    public:
+        explicit RoutePlanner() noexcept;
+        RoutePlanner(const RoutePlanner& other) = delete;
+        RoutePlanner(RoutePlanner&& other) = delete;
+
+        RoutePlanner& operator=(const RoutePlanner& rhs) = delete;
+        RoutePlanner& operator=(RoutePlanner&& rhs) = delete;
+
+        ~RoutePlanner();
+
+        /**
+         * @brief 목표 셀의 방문 순서를 계산
+         * @param start 시작 위치 (지렁이 머리)
+         * @param targets 방문할 목표 셀 목록, 방문 순서대로 재배열됨
+         */
+        void Plan(_In_ const POINT& start, _Inout_ std::vector<POINT>& targets);
+
+        /**
+         * @brief start에서 출발해 targets를 순서대로 방문할 때의 총 이동 횟수를 반환
+         * @param start 시작 위치
+         * @param targets 방문 순서
+         */
+        [[nodiscard]] static size_t GetRouteLength(_In_ const POINT& start, _In_ const std::vector<POINT>& targets);
+
+    private:
+        /**
+         * @brief 두 셀 사이의 맨해튼 거리
+         */
+        [[nodiscard]] static size_t GetDistance(_In_ const POINT& lhs, _In_ const POINT& rhs) noexcept;
+
+        /**
+         * @brief mRoute[0]에서 출발해 가장 가까운 셀을 차례로 고르는 초기 순서를 만듦
+         * @details 거리가 같으면 targets에서 앞선 셀을 선택
+         */
+        void BuildNearestNeighbourRoute();
+
+        /**
+         * @brief 경로 구간 하나를 뒤집어 짧아지는 경우를 찾아 적용 (2-opt)
+         * @return 경로가 짧아졌으면 true
+         */
+        [[nodiscard]] bool ImproveTwoOpt();
+
+        /**
+         * @brief 연속된 1~3개의 셀을 다른 위치로 옮겨(필요하면 뒤집어) 짧아지는 경우를 찾아 적용 (Or-opt)
+         * @return 경로가 짧아졌으면 true
+         */
+        [[nodiscard]] bool ImproveOrOpt();
+
+        /**
+         * @brief 남은 평가 횟수에서 count만큼 차감
+         * @param count 이번에 평가할 후보 수
+         * @return 남은 횟수가 충분하면 true, 부족하면 남은 횟수를 0으로 만들고 false
+         */
+        [[nodiscard]] bool ConsumeEvaluations(_In_ size_t count) noexcept;
+
+    private:
+        // Plan() 한 번에 평가할 수 있는 최대 후보 수 (371칸이 모두 목표여도 전체 개선을 수십 번 반복할 수 있는 양)
+        static constexpr size_t mEvaluationBudget = size_t{1} << 24;
+        static constexpr size_t mMaxSegmentLength = 3; // Or-opt로 옮기는 최대 구간 길이
+
+        size_t mRemainingEvaluations = 0; // 현재 Plan()에서 남은 평가 횟수
+
+        std::vector<POINT> mRoute; // [0]은 시작 위치, 이후 방문 순서 (작업 간 재사용)
+        std::vector<POINT> mScratch; // Or-opt 적용 시 임시 버퍼
+    };
+} // CoTigraphy
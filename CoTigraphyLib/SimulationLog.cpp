@@ -0,0 +1,209 @@
+﻿// \file SimulationLog.cpp
+// \last_updated 2026-10-16
+// \author Oh Sungsik <ohsungsik@outlook.com>
+// \copyright (C) 2025. Oh Sungsik. All rights reserved.
+
+#include "pch.hpp"
+#include "SimulationLog.hpp"
+
+#include <filesystem>
+#include <fstream>
+
+namespace CoTigraphy
+{
+    namespace
+    {
+        constexpr char fileMagic[4] = {'C', 'T', 'S', 'L'}; // CoTigraphy Simulation Log
+
+        // 지원하는 최대 크기 (손상된 파일로 인한 과도한 할당 방지)
+        constexpr uint32_t maxWeekCount = std::numeric_limits<uint16_t>::max();
+        constexpr uint32_t maxDayCount = 7;
+        constexpr uint32_t maxEventCount = 1u << 26;
+
+        template <typename T>
+        void WriteValue(_Inout_ std::ostream& stream, _In_ const T& value)
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+            stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+        template <typename T>
+        [[nodiscard]] bool ReadValue(_Inout_ std::istream& stream, _Out_ T& value)
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+            stream.read(reinterpret_cast<char*>(&value), sizeof(T));
+            return stream.good();
+        }
+    }
+
+    SimulationLog::SimulationLog() noexcept
+    = default;
+
+    SimulationLog::~SimulationLog()
+    = default;
+
+    void SimulationLog::Reset(_In_ const GridData& gridData)
+    {
+        PRECONDITION(gridData.mWeekCount <= maxWeekCount);
+        PRECONDITION(gridData.mDayCount <= maxDayCount);
+
+        mGridData = gridData;
+        mEvents.clear();
+    }
+
+    void SimulationLog::Record(_In_ const SimulationEvent& simulationEvent)
+    {
+        PRECONDITION(simulationEvent.mWeek < mGridData.mWeekCount);
+        PRECONDITION(simulationEvent.mDay < mGridData.mDayCount);
+
+        mEvents.push_back(simulationEvent);
+    }
+
+    Error SimulationLog::WriteTo(_Inout_ std::ostream& stream) const
+    {
+        ASSERT(mGridData.mCells.size() == mGridData.mWeekCount);
+
+        stream.write(fileMagic, sizeof(fileMagic));
+        WriteValue(stream, mFileVersion);
+
+        WriteValue(stream, static_cast<uint32_t>(mGridData.mWeekCount));
+        WriteValue(stream, static_cast<uint32_t>(mGridData.mDayCount));
+        WriteValue(stream, static_cast<uint64_t>(mGridData.mMaxCount));
+
+        // 마지막 주는 7일보다 짧을 수 있으므로 주마다 셀 수를 기록
+        for (const std::vector<GridCell>& week : mGridData.mCells)
+        {
+            WriteValue(stream, static_cast<uint32_t>(week.size()));
+            for (const GridCell& cell : week)
+            {
+                WriteValue(stream, static_cast<uint64_t>(cell.mCount));
+                WriteValue(stream, static_cast<uint32_t>(cell.mColor));
+            }
+        }
+
+        WriteValue(stream, static_cast<uint32_t>(mEvents.size()));
+        if (mEvents.empty() == false)
+        {
+            stream.write(reinterpret_cast<const char*>(mEvents.data()),
+                         static_cast<std::streamsize>(mEvents.size() * sizeof(SimulationEvent)));
+        }
+
+        if (stream.good() == false)
+            return MAKE_ERROR(eErrorCode::FileIOFailure);
+
+        return MAKE_ERROR(eErrorCode::Succeeded);
+    }
+
+    Error SimulationLog::ReadFrom(_Inout_ std::istream& stream)
+    {
+        mGridData = GridData{};
+        mEvents.clear();
+
+        char magic[sizeof(fileMagic)] = {};
+        stream.read(magic, sizeof(magic));
+        uint32_t version = 0;
+        if (stream.good() == false || memcmp(magic, fileMagic, sizeof(fileMagic)) != 0 ||
+            ReadValue(stream, version) == false || version != mFileVersion)
+        {
+            return MAKE_ERROR(eErrorCode::InvalidSimulationLog);
+        }
+
+        uint32_t weekCount = 0;
+        uint32_t dayCount = 0;
+        uint64_t maxCount = 0;
+        if (ReadValue(stream, weekCount) == false || ReadValue(stream, dayCount) == false ||
+            ReadValue(stream, maxCount) == false || weekCount == 0 || weekCount > maxWeekCount || dayCount == 0 ||
+            dayCount > maxDayCount)
+        {
+            return MAKE_ERROR(eErrorCode::InvalidSimulationLog);
+        }
+
+        GridData gridData;
+        gridData.mWeekCount = weekCount;
+        gridData.mDayCount = dayCount;
+        gridData.mMaxCount = maxCount;
+        gridData.mCells.resize(weekCount);
+
+        for (size_t week = 0; week < weekCount; ++week)
+        {
+            uint32_t cellCount = 0;
+            if (ReadValue(stream, cellCount) == false || cellCount > maxDayCount)
+                return MAKE_ERROR(eErrorCode::InvalidSimulationLog);
+
+            gridData.mCells[week].resize(cellCount);
+            for (size_t day = 0; day < cellCount; ++day)
+            {
+                GridCell& cell = gridData.mCells[week][day];
+                uint64_t count = 0;
+                uint32_t color = 0;
+                if (ReadValue(stream, count) == false || ReadValue(stream, color) == false)
+                    return MAKE_ERROR(eErrorCode::InvalidSimulationLog);
+
+                cell.mWeek = week;
+                cell.mDay = day;
+                cell.mCount = count;
+                cell.mColor = color;
+            }
+        }
+
+        // Grid::IsInside가 허용하는 모든 셀이 존재해야 함
+        for (const std::vector<GridCell>& week : gridData.mCells)
+        {
+            if (week.size() < dayCount)
+                return MAKE_ERROR(eErrorCode::InvalidSimulationLog);
+        }
+
+        uint32_t eventCount = 0;
+        // 이벤트가 없으면 그릴 프레임이 없으므로 (FrameWriter는 한 프레임 이상 필요) 잘못된 기록으로 취급
+        if (ReadValue(stream, eventCount) == false || eventCount == 0 || eventCount > maxEventCount)
+            return MAKE_ERROR(eErrorCode::InvalidSimulationLog);
+
+        std::vector<SimulationEvent> events(eventCount);
+        if (eventCount > 0)
+        {
+            stream.read(reinterpret_cast<char*>(events.data()),
+                        static_cast<std::streamsize>(events.size() * sizeof(SimulationEvent)));
+            if (stream.fail())
+                return MAKE_ERROR(eErrorCode::InvalidSimulationLog);
+        }
+
+        for (const SimulationEvent& simulationEvent : events)
+        {
+            if (simulationEvent.mWeek >= weekCount || simulationEvent.mDay >= dayCount)
+                return MAKE_ERROR(eErrorCode::InvalidSimulationLog);
+        }
+
+        mGridData = std::move(gridData);
+        mEvents = std::move(events);
+
+        return MAKE_ERROR(eErrorCode::Succeeded);
+    }
+
+    Error SimulationLog::SaveToFile(_In_ const std::wstring& fileName) const
+    {
+        PRECONDITION(fileName.empty() == false);
+
+        std::ofstream file(std::filesystem::path(fileName), std::ios::binary | std::ios::trunc);
+        if (file.is_open() == false)
+            return MAKE_ERROR(eErrorCode::FileIOFailure);
+
+        RETURN_IF_FAILED(WriteTo(file));
+
+        file.close();
+        if (file.fail())
+            return MAKE_ERROR(eErrorCode::FileIOFailure);
+
+        return MAKE_ERROR(eErrorCode::Succeeded);
+    }
+
+    Error SimulationLog::LoadFromFile(_In_ const std::wstring& fileName)
+    {
+        PRECONDITION(fileName.empty() == false);
+
+        std::ifstream file(std::filesystem::path(fileName), std::ios::binary);
+        if (file.is_open() == false)
+            return MAKE_ERROR(eErrorCode::FileIOFailure);
+
+        return ReadFrom(file);
+    }
+} // CoTigraphy
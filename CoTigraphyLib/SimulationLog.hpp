@@ -0,0 +1,130 @@
+﻿// \file SimulationLog.hpp
+// \last_updated 2026-10-16
+// \author Oh Sungsik <ohsungsik@outlook.com>
+// \copyright (C) 2025. Oh Sungsik. All rights reserved.
+
+#pragma once
+
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+#include "Grid.hpp"
+
+namespace CoTigraphy
+{
+    /**
+     * @brief SimulationEvent::mFlags에 사용하는 비트
+     */
+    enum class eSimulationEventFlag : uint8_t
+    {
+        None = 0x00,
+        AteContribution = 0x01, // 머리가 Contribution이 있는 셀을 먹음 (이동 경로상의 빈 셀이면 0)
+    };
+
+    /**
+     * @brief 시뮬레이션 한 프레임에서 일어난 일 (지렁이 머리 이동 1회)
+     * @details
+     * - 지렁이 머리가 (mWeek, mDay)로 이동하고, 그 셀의 Contribution 횟수는 0, 색상은 mColor가 됨
+     * - 나머지 구간 위치는 이전 머리 위치들로부터 결정되므로 기록하지 않음
+     * - 파일에 그대로 기록되므로 크기와 배치를 바꾸면 SimulationLog의 파일 버전을 올려야 함
+     */
+    struct SimulationEvent
+    {
+        uint16_t mWeek = 0; // 새 머리의 열 인덱스 (주)
+        uint8_t mDay = 0; // 새 머리의 행 인덱스 (요일)
+        uint8_t mFlags = 0; // eSimulationEventFlag 비트 조합
+        COLORREF mColor = 0; // 먹힌 셀의 새 색상
+
+        /**
+         * @brief 지정한 flag가 설정되어 있는지 확인
+         */
+        [[nodiscard]] bool HasFlag(_In_ const eSimulationEventFlag flag) const noexcept
+        {
+            return (mFlags & static_cast<uint8_t>(flag)) != 0;
+        }
+    };
+
+    static_assert(sizeof(SimulationEvent) == 8);
+
+    /**
+     * @brief 초기 Grid와 프레임별 SimulationEvent 목록을 담는 시뮬레이션 기록
+     * @details
+     * - 한 번 시뮬레이션한 결과를 BFS 없이 여러 번, 혹은 다른 프로세스에서 다시 렌더링하기 위해 사용
+     * - 초기 Grid를 함께 보관하므로 GitHub API 없이도 렌더링 가능
+     * - 파일 형식: 헤더("CTSL", 버전) + Grid 크기/셀 정보 + 이벤트 배열 (little-endian)
+     */
+    class SimulationLog final
+    {
+    public:
+        explicit SimulationLog() noexcept;
+        SimulationLog(const SimulationLog& other) = delete;
+        SimulationLog(SimulationLog&& other) = delete;
+
+        SimulationLog& operator=(const SimulationLog& rhs) = delete;
+        SimulationLog& operator=(SimulationLog&& rhs) = delete;
+
+        ~SimulationLog();
+
+        /**
+         * @brief 기록을 비우고 시뮬레이션 시작 시점의 Grid를 설정
+         * @param gridData 시뮬레이션 시작 시점의 Contribution calendar 데이터
+         * @details
+         * - 이전 기록의 이벤트 버퍼는 재할당 없이 재사용
+         */
+        void Reset(_In_ const GridData& gridData);
+
+        /**
+         * @brief 프레임 하나의 이벤트를 추가
+         * @param simulationEvent 추가할 이벤트
+         */
+        void Record(_In_ const SimulationEvent& simulationEvent);
+
+        /**
+         * @brief 시뮬레이션 시작 시점의 Grid 데이터를 반환
+         */
+        [[nodiscard]] const GridData& GetGridData() const noexcept { return mGridData; }
+
+        /**
+         * @brief 기록된 이벤트 목록을 반환 (프레임 순서)
+         */
+        [[nodiscard]] const std::vector<SimulationEvent>& GetEvents() const noexcept { return mEvents; }
+
+        /**
+         * @brief 기록을 바이너리 형식으로 stream에 씀
+         * @param stream 출력 stream (binary 모드)
+         * @return 성공 시 Succeeded, 쓰기 실패 시 FileIOFailure
+         */
+        [[nodiscard]] Error WriteTo(_Inout_ std::ostream& stream) const;
+
+        /**
+         * @brief stream에서 바이너리 형식의 기록을 읽음
+         * @param stream 입력 stream (binary 모드)
+         * @return 성공 시 Succeeded, 형식이 잘못되었으면 InvalidSimulationLog
+         * @details
+         * - 실패 시 기존 기록은 비워짐
+         * - 주/요일 수가 0이거나 이벤트가 하나도 없는 기록도 InvalidSimulationLog (렌더링할 프레임이 없음)
+         */
+        [[nodiscard]] Error ReadFrom(_Inout_ std::istream& stream);
+
+        /**
+         * @brief 기록을 파일로 저장
+         * @param fileName 저장할 파일 경로 (기존 파일은 덮어씀)
+         * @return 성공 시 Succeeded, 실패 시 에러 코드
+         */
+        [[nodiscard]] Error SaveToFile(_In_ const std::wstring& fileName) const;
+
+        /**
+         * @brief 파일에서 기록을 읽음
+         * @param fileName 읽을 파일 경로
+         * @return 성공 시 Succeeded, 실패 시 에러 코드
+         */
+        [[nodiscard]] Error LoadFromFile(_In_ const std::wstring& fileName);
+
+    private:
+        static constexpr uint32_t mFileVersion = 1; // 파일 형식 버전
+
+        GridData mGridData; // 시뮬레이션 시작 시점의 Grid
+        std::vector<SimulationEvent> mEvents; // 프레임별 이벤트
+    };
+} // CoTigraphy
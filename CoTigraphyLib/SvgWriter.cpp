@@ -0,0 +1,331 @@
+﻿// \file SvgWriter.cpp
+// \last_updated 2026-10-16
+// \author Oh Sungsik <ohsungsik@outlook.com>
+// \copyright (C) 2025. Oh Sungsik. All rights reserved.
+
+#include "pch.hpp"
+#include "SvgWriter.hpp"
+
+#include <filesystem>
+
+#include "FrameWriter.hpp"
+#include "Grid.hpp"
+
+namespace CoTigraphy
+{
+    namespace
+    {
+        constexpr wchar_t svgFileExtension[] = L".svg";
+        constexpr uint64_t keyTimeDenominator = 100000; // keyTimes 소수점 5자리 (전체 길이 100초까지 1ms 단위)
+
+        /**
+         * @brief [0, 1] 범위의 keyTimes 값을 로캘과 무관한 소수로 추가
+         * @param timeMs 값의 표시 시작 시간 (ms)
+         * @param totalDurationMs 애니메이션 전체 길이 (ms)
+         */
+        void AppendKeyTime(_Inout_ std::string& out, _In_ const int timeMs, _In_ const int totalDurationMs)
+        {
+            PRECONDITION(totalDurationMs > 0);
+
+            const uint64_t scaled = (static_cast<uint64_t>(timeMs) * keyTimeDenominator +
+                static_cast<uint64_t>(totalDurationMs) / 2) / static_cast<uint64_t>(totalDurationMs);
+            if (scaled == 0)
+            {
+                out += '0';
+                return;
+            }
+            if (scaled >= keyTimeDenominator)
+            {
+                out += '1';
+                return;
+            }
+
+            // 5자리로 채운 뒤 끝의 0을 제거
+            std::string fraction = std::to_string(scaled);
+            fraction.insert(0, 5 - fraction.size(), '0');
+            fraction.erase(fraction.find_last_not_of('0') + 1);
+
+            out += "0.";
+            out += fraction;
+        }
+
+        /**
+         * @brief "#rrggbb" 형식의 색상을 추가
+         */
+        void AppendHexColor(_Inout_ std::string& out, _In_ const COLORREF color)
+        {
+            constexpr char hexDigits[] = "0123456789abcdef";
+            out += '#';
+            for (const BYTE channel : {GetRValue(color), GetGValue(color), GetBValue(color)})
+            {
+                out += hexDigits[channel >> 4];
+                out += hexDigits[channel & 0x0F];
+            }
+        }
+    }
+
+    SvgWriter::SvgWriter() noexcept
+    = default;
+
+    SvgWriter::~SvgWriter()
+    = default;
+
+    void SvgWriter::Write(_In_ const SimulationLog& simulationLog, _In_ const GridCanvasContext& gridCanvasContext,
+                          _In_ const eTimeline timeline)
+    {
+        PRECONDITION(gridCanvasContext.mCellSize != 0);
+        PRECONDITION(gridCanvasContext.mScale != 0);
+
+        mGridCanvasContext = gridCanvasContext;
+
+        Grid grid(simulationLog.GetGridData());
+        Worm worm(grid);
+
+        const std::vector<SimulationEvent>& events = simulationLog.GetEvents();
+        FrameTimeline::Build(events, timeline, mFrameDurations);
+
+        // 셀마다 초기 색상에서 시작 (이전 작업의 목록은 재할당 없이 재사용)
+        const std::vector<COLORREF>& initialColors = grid.GetColors();
+        mCellKeyframes.resize(initialColors.size());
+        for (size_t cellIndex = 0; cellIndex < initialColors.size(); ++cellIndex)
+        {
+            mCellKeyframes[cellIndex].clear();
+            mCellKeyframes[cellIndex].emplace_back(0, initialColors[cellIndex]);
+        }
+
+        mFrameTimes.clear();
+        mWormPoints.clear();
+        mIsUniform = true;
+
+        // 렌더러와 같이 시간이 0인 이벤트는 다음 프레임에서 함께 보임
+        int timeMs = 0;
+        size_t pendingEventIndex = 0;
+        for (size_t eventIndex = 0; eventIndex < events.size(); ++eventIndex)
+        {
+            worm.Apply(events[eventIndex]);
+            const int durationMs = mFrameDurations[eventIndex];
+            if (durationMs == 0)
+                continue;
+
+            for (; pendingEventIndex <= eventIndex; ++pendingEventIndex)
+            {
+                const size_t week = events[pendingEventIndex].mWeek;
+                const size_t day = events[pendingEventIndex].mDay;
+                const COLORREF color = grid.GetColor(week, day);
+
+                std::vector<std::pair<int, COLORREF>>& colorKeyframes = mCellKeyframes[grid.GetCellIndex(week, day)];
+                if (colorKeyframes.back().second == color)
+                    continue;
+
+                // 첫 프레임에서 바뀐 셀은 처음부터 바뀐 색상
+                if (colorKeyframes.back().first == timeMs)
+                    colorKeyframes.back().second = color;
+                else
+                    colorKeyframes.emplace_back(timeMs, color);
+            }
+
+            // 첫 이벤트는 항상 프레임을 만들므로 첫 프레임의 시간과 비교
+            if (durationMs != mFrameDurations.front())
+                mIsUniform = false;
+
+            mFrameTimes.push_back(timeMs);
+            for (const WormSegment& wormSegment : worm.GetWorm())
+                mWormPoints.push_back(wormSegment.mPoint);
+
+            timeMs += durationMs;
+        }
+        mTotalDurationMs = timeMs;
+
+        // 좌표는 논리 픽셀, 출력 크기만 배율을 적용
+        const size_t logicalWidth = mGridCanvasContext.mWidth / mGridCanvasContext.mScale;
+        const size_t logicalHeight = mGridCanvasContext.mHeight / mGridCanvasContext.mScale;
+
+        mSvgData.clear();
+        mSvgData += R"(<svg xmlns="http://www.w3.org/2000/svg" width=")";
+        mSvgData += std::to_string(mGridCanvasContext.mWidth);
+        mSvgData += R"(" height=")";
+        mSvgData += std::to_string(mGridCanvasContext.mHeight);
+        mSvgData += R"(" viewBox="0 0 )";
+        mSvgData += std::to_string(logicalWidth);
+        mSvgData += ' ';
+        mSvgData += std::to_string(logicalHeight);
+        mSvgData += "\">\n";
+
+        // 배경 (셀 사이 여백)
+        mSvgData += R"(<rect width="100%" height="100%" fill=")";
+        AppendHexColor(mSvgData, mGridCanvasContext.mBackgroundColor);
+        mSvgData += "\"/>\n";
+
+        for (size_t week = 0; week < grid.GetWeekCount(); ++week)
+        {
+            for (size_t day = 0; day < grid.GetDayCount(); ++day)
+                AppendCell(week, day, mCellKeyframes[grid.GetCellIndex(week, day)]);
+        }
+
+        // 지렁이는 셀 위에 머리부터 차례로 그림 (GridCanvas와 같은 순서)
+        const std::array<WormSegment, 4> wormSegments = worm.GetWorm();
+        for (size_t segmentIndex = 0; segmentIndex < wormSegments.size(); ++segmentIndex)
+            AppendWormSegment(segmentIndex, wormSegments[segmentIndex]);
+
+        mSvgData += "</svg>\n";
+    }
+
+    Error SvgWriter::SaveToFile(_In_ const std::wstring& fileName) const
+    {
+        PRECONDITION(mSvgData.empty() == false);
+
+        RETURN_IF_FAILED(FrameWriter::ValidateFileName(fileName, svgFileExtension));
+
+        return FrameWriter::WriteToFile(fileName, reinterpret_cast<const uint8_t*>(mSvgData.data()),
+                                        mSvgData.size());
+    }
+
+    bool SvgWriter::IsSvgFileName(_In_ const std::wstring& fileName)
+    {
+        const std::filesystem::path path(fileName);
+        return _wcsicmp(path.extension().c_str(), svgFileExtension) == 0;
+    }
+
+    void SvgWriter::AppendCell(_In_ const size_t week, _In_ const size_t day,
+                               _In_ const std::vector<std::pair<int, COLORREF>>& colorKeyframes)
+    {
+        PRECONDITION(colorKeyframes.empty() == false);
+
+        const size_t cellStride = mGridCanvasContext.mCellSize + mGridCanvasContext.mCellMargin;
+
+        mSvgData += R"(<rect x=")";
+        mSvgData += std::to_string(week * cellStride);
+        mSvgData += R"(" y=")";
+        mSvgData += std::to_string(day * cellStride);
+        mSvgData += R"(" width=")";
+        mSvgData += std::to_string(mGridCanvasContext.mCellSize);
+        mSvgData += R"(" height=")";
+        mSvgData += std::to_string(mGridCanvasContext.mCellSize);
+        if (mGridCanvasContext.mCellRadius != 0)
+        {
+            mSvgData += R"(" rx=")";
+            mSvgData += std::to_string(mGridCanvasContext.mCellRadius);
+        }
+        mSvgData += R"(" fill=")";
+        AppendColor(colorKeyframes.front().second);
+
+        // 한 번도 바뀌지 않는 셀이 대부분이므로 애니메이션 없이 끝냄
+        if (colorKeyframes.size() == 1 || mTotalDurationMs == 0)
+        {
+            mSvgData += "\"/>\n";
+            return;
+        }
+
+        mSvgData += R"("><animate attributeName="fill" values=")";
+        std::vector<int> keyTimes;
+        keyTimes.reserve(colorKeyframes.size());
+        for (size_t keyframeIndex = 0; keyframeIndex < colorKeyframes.size(); ++keyframeIndex)
+        {
+            if (keyframeIndex > 0)
+                mSvgData += ';';
+            AppendColor(colorKeyframes[keyframeIndex].second);
+            keyTimes.push_back(colorKeyframes[keyframeIndex].first);
+        }
+        mSvgData += '"';
+        AppendTiming(keyTimes);
+        mSvgData += "/></rect>\n";
+    }
+
+    void SvgWriter::AppendWormSegment(_In_ const size_t segmentIndex, _In_ const WormSegment& wormSegment)
+    {
+        PRECONDITION(0.0f < wormSegment.mScale);
+        PRECONDITION(wormSegment.mScale <= 1.0f);
+
+        // GridCanvas::GetRect()와 같이 셀 중앙을 기준으로 축소
+        const float center = static_cast<float>(mGridCanvasContext.mCellSize) * 0.5f;
+        const float halfSize = static_cast<float>(mGridCanvasContext.mCellSize) * wormSegment.mScale * 0.5f;
+        const LONG inset = static_cast<LONG>(center - halfSize);
+        const LONG size = static_cast<LONG>(center + halfSize) - inset;
+
+        const size_t frameCount = mFrameTimes.size();
+        const size_t segmentCount = frameCount > 0 ? mWormPoints.size() / frameCount : 0;
+        const LONG cellStride = static_cast<LONG>(mGridCanvasContext.mCellSize + mGridCanvasContext.mCellMargin);
+
+        // 프레임이 없으면 마지막(초기) 위치에 정지
+        const POINT firstPoint = frameCount > 0 ? mWormPoints[segmentIndex] : wormSegment.mPoint;
+
+        mSvgData += R"(<rect x=")";
+        mSvgData += std::to_string(inset);
+        mSvgData += R"(" y=")";
+        mSvgData += std::to_string(inset);
+        mSvgData += R"(" width=")";
+        mSvgData += std::to_string(size);
+        mSvgData += R"(" height=")";
+        mSvgData += std::to_string(size);
+        if (mGridCanvasContext.mCellRadius != 0)
+        {
+            mSvgData += R"(" rx=")";
+            mSvgData += std::to_string(mGridCanvasContext.mCellRadius);
+        }
+        mSvgData += R"(" fill=")";
+        AppendColor(wormSegment.mColor);
+        mSvgData += R"(" transform="translate()";
+        mSvgData += std::to_string(firstPoint.x * cellStride);
+        mSvgData += ',';
+        mSvgData += std::to_string(firstPoint.y * cellStride);
+        mSvgData += ')';
+
+        if (frameCount < 2)
+        {
+            mSvgData += "\"/>\n";
+            return;
+        }
+
+        mSvgData += R"("><animateTransform attributeName="transform" type="translate" values=")";
+        for (size_t frameIndex = 0; frameIndex < frameCount; ++frameIndex)
+        {
+            const POINT& point = mWormPoints[frameIndex * segmentCount + segmentIndex];
+            if (frameIndex > 0)
+                mSvgData += ';';
+            mSvgData += std::to_string(point.x * cellStride);
+            mSvgData += ',';
+            mSvgData += std::to_string(point.y * cellStride);
+        }
+        mSvgData += '"';
+
+        // 같은 간격이면 discrete 애니메이션이 값을 dur에 고르게 나누므로 keyTimes가 필요 없음
+        AppendTiming(mIsUniform ? std::vector<int>{} : mFrameTimes);
+        mSvgData += "/></rect>\n";
+    }
+
+    void SvgWriter::AppendTiming(_In_ const std::vector<int>& keyTimes)
+    {
+        PRECONDITION(mTotalDurationMs > 0);
+
+        if (keyTimes.empty() == false)
+        {
+            mSvgData += R"( keyTimes=")";
+            for (size_t keyTimeIndex = 0; keyTimeIndex < keyTimes.size(); ++keyTimeIndex)
+            {
+                if (keyTimeIndex > 0)
+                    mSvgData += ';';
+                AppendKeyTime(mSvgData, keyTimes[keyTimeIndex], mTotalDurationMs);
+            }
+            mSvgData += '"';
+        }
+
+        mSvgData += R"( dur=")";
+        mSvgData += std::to_string(mTotalDurationMs);
+        mSvgData += R"(ms" calcMode="discrete" repeatCount="indefinite")";
+    }
+
+    void SvgWriter::AppendColor(_In_ const COLORREF color)
+    {
+        COLORREF themeColor = color;
+        for (const auto& [sourceColor, targetColor] : mGridCanvasContext.mColorTable)
+        {
+            if (sourceColor == color)
+            {
+                themeColor = targetColor;
+                break;
+            }
+        }
+
+        AppendHexColor(mSvgData, themeColor);
+    }
+} // CoTigraphy
@@ -0,0 +1,111 @@
+﻿// \file SvgWriter.hpp
+// \last_updated 2026-10-16
+// \author Oh Sungsik <ohsungsik@outlook.com>
+// \copyright (C) 2025. Oh Sungsik. All rights reserved.
+
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "FrameTimeline.hpp"
+#include "GridCanvas.hpp"
+#include "SimulationLog.hpp"
+#include "Worm.hpp"
+
+namespace CoTigraphy
+{
+    /**
+     * @brief 기록된 시뮬레이션을 래스터화 없이 SVG 애니메이션으로 변환하는 클래스
+     * @details
+     * - 셀은 <rect> 하나씩, 지렁이 구간은 <rect> 4개로 그리고 시간에 따른 변화는 SMIL 애니메이션으로 기록
+     *   (셀은 색상이 바뀔 때만 <animate>, 지렁이 구간은 프레임마다 위치를 바꾸는 <animateTransform>)
+     * - 프레임 시간은 FrameTimeline::Build()로 정하며, 시간이 0인 이벤트는 WebP 출력과 같이 다음 프레임에 보임
+     * - 모든 애니메이션은 calcMode="discrete"에 같은 dur로 반복하므로 WebP 출력과 같은 순서로 재생됨
+     * - 좌표는 논리 픽셀(viewBox)로 쓰고 GridCanvasContext::mScale은 width/height에만 적용
+     * - Write -> SaveToFile 순으로 사용하며, 작업 간에 버퍼를 재사용
+     */
+    class SvgWriter final
+    {
+    public:
+        explicit SvgWriter() noexcept;
+        SvgWriter(const SvgWriter& other) = delete;
+        SvgWriter(SvgWriter&& other) = delete;
+
+        SvgWriter& operator=(const SvgWriter& rhs) = delete;
+        SvgWriter& operator=(SvgWriter&& rhs) = delete;
+
+        ~SvgWriter();
+
+        /**
+         * @brief 기록된 시뮬레이션 전체를 SVG 문서로 변환
+         * @param simulationLog 초기 Grid와 프레임별 이벤트
+         * @param gridCanvasContext 캔버스 구성 정보 (셀 배치, 배율, 테마), mPixelFormat은 사용하지 않음
+         * @param timeline 이벤트별 프레임 시간 계산 방식
+         * @details
+         * - 이벤트가 없으면 애니메이션 없이 첫 화면만 그림
+         */
+        void Write(_In_ const SimulationLog& simulationLog, _In_ const GridCanvasContext& gridCanvasContext,
+                   _In_ const eTimeline timeline);
+
+        /**
+         * @brief Write()로 만든 SVG 문서를 파일로 저장
+         * @param fileName 저장할 파일 경로 (.svg 확장자만 허용)
+         * @return 성공 시 Succeeded, 실패 시 에러 코드
+         * @pre Write() 이후 호출
+         */
+        [[nodiscard]] Error SaveToFile(_In_ const std::wstring& fileName) const;
+
+        /**
+         * @brief Write()로 만든 SVG 문서를 반환 (UTF-8)
+         */
+        [[nodiscard]] const std::string& GetData() const noexcept { return mSvgData; }
+
+        /**
+         * @brief 출력 경로가 SVG 파일인지 확인 (대소문자 무시)
+         * @param fileName 출력 경로
+         */
+        [[nodiscard]] static bool IsSvgFileName(_In_ const std::wstring& fileName);
+
+    private:
+        /**
+         * @brief 셀 하나의 <rect>를 추가 (색상이 바뀌면 <animate> 포함)
+         * @param week 열 인덱스
+         * @param day 행 인덱스
+         * @param colorKeyframes (표시 시작 시간 ms, 색상) 목록, 첫 항목은 0ms
+         */
+        void AppendCell(_In_ const size_t week, _In_ const size_t day,
+                        _In_ const std::vector<std::pair<int, COLORREF>>& colorKeyframes);
+
+        /**
+         * @brief 지렁이 구간 하나의 <rect>를 추가 (프레임이 2개 이상이면 <animateTransform> 포함)
+         * @param segmentIndex 구간 번호 (0: 머리)
+         * @param wormSegment 구간의 색상과 크기
+         */
+        void AppendWormSegment(_In_ const size_t segmentIndex, _In_ const WormSegment& wormSegment);
+
+        /**
+         * @brief 애니메이션 공통 속성(keyTimes, dur, calcMode, repeatCount)을 추가
+         * @param keyTimes 값마다 표시 시작 시간 (ms), 비어 있으면 값이 같은 간격이라 keyTimes를 생략
+         */
+        void AppendTiming(_In_ const std::vector<int>& keyTimes);
+
+        /**
+         * @brief "#rrggbb" 형식의 색상을 추가 (GridCanvasContext::mColorTable 적용)
+         */
+        void AppendColor(_In_ const COLORREF color);
+
+    private:
+        GridCanvasContext mGridCanvasContext; // 현재 작업의 캔버스 구성 정보
+        std::vector<int> mFrameDurations; // 이벤트별 프레임 표시 시간 (FrameTimeline::Build())
+        int mTotalDurationMs = 0; // 애니메이션 전체 길이 (0: 애니메이션 없음)
+
+        std::vector<std::vector<std::pair<int, COLORREF>>> mCellKeyframes; // 셀별 (표시 시작 시간 ms, 색상)
+        std::vector<int> mFrameTimes; // 프레임별 표시 시작 시간 (ms)
+        bool mIsUniform = true; // 모든 프레임의 표시 시간이 같은지 (지렁이 애니메이션의 keyTimes 생략)
+        std::vector<POINT> mWormPoints; // 프레임별 지렁이 구간 위치 (프레임 × 4, 머리부터)
+
+        std::string mSvgData; // Write() 결과
+    };
+} // CoTigraphy
@@ -0,0 +1,278 @@
+﻿// \file TileCache.cpp
+// \last_updated 2026-10-16
+// \author Oh Sungsik <ohsungsik@outlook.com>
+// \copyright (C) 2025. Oh Sungsik. All rights reserved.
+
+#include "pch.hpp"
+#include "TileCache.hpp"
+
+#include <cmath>
+#include <mutex>
+
+namespace CoTigraphy
+{
+    namespace
+    {
+        constexpr int64_t subpixelBits = 8; // 고정소수점 좌표의 소수 비트 수 (1/256 픽셀)
+        constexpr int64_t sampleGrid = 8; // 픽셀 하나를 나누는 표본 수 (가로, 세로 각각)
+        constexpr int64_t coverageLevels = 16; // 덮는 비율 단계 수 (셀 색상마다 섞인 가장자리 색상이 최대 coverageLevels - 1개)
+
+        /**
+         * @brief 셀 왼쪽 위 기준 고정소수점 좌표로 나타낸 크기 비율 적용 셀
+         */
+        struct ScaledShape
+        {
+            int64_t mFirst = 0; // 왼쪽/위쪽 가장자리 (포함)
+            int64_t mLast = 0; // 오른쪽/아래쪽 가장자리 (제외)
+            int64_t mRadius = 0; // 모서리 반지름
+        };
+
+        ScaledShape GetScaledShape(_In_ const size_t cellSize, _In_ const float scale, _In_ const size_t cornerRadius)
+        {
+            const double scaledSize = static_cast<double>(cellSize) * static_cast<double>(scale);
+            const int64_t center = static_cast<int64_t>(cellSize) << (subpixelBits - 1);
+            const int64_t halfSize = std::llround(scaledSize * (1 << (subpixelBits - 1)));
+
+            ScaledShape scaledShape;
+            scaledShape.mFirst = center - halfSize;
+            scaledShape.mLast = center + halfSize;
+            scaledShape.mRadius = std::min<int64_t>(halfSize, std::llround(static_cast<double>(cornerRadius) *
+                                                                  static_cast<double>(scale) * (1 << subpixelBits)));
+            return scaledShape;
+        }
+
+        bool IsInside(_In_ const ScaledShape& scaledShape, _In_ const int64_t x, _In_ const int64_t y) noexcept
+        {
+            if (x < scaledShape.mFirst || x >= scaledShape.mLast || y < scaledShape.mFirst || y >= scaledShape.mLast)
+                return false;
+
+            // 모서리 원의 중심까지 거리로 둥근 모서리 바깥을 제외
+            const int64_t nearestX = std::clamp(x, scaledShape.mFirst + scaledShape.mRadius,
+                                                scaledShape.mLast - scaledShape.mRadius);
+            const int64_t nearestY = std::clamp(y, scaledShape.mFirst + scaledShape.mRadius,
+                                                scaledShape.mLast - scaledShape.mRadius);
+            const int64_t dx = x - nearestX;
+            const int64_t dy = y - nearestY;
+            return dx * dx + dy * dy <= scaledShape.mRadius * scaledShape.mRadius;
+        }
+    }
+
+    TileCache::TileCache(_In_ const size_t maxByteSize) noexcept
+        : mMaxByteSize(maxByteSize)
+    {
+    }
+
+    TileCache::~TileCache()
+    = default;
+
+    TileCache& TileCache::GetShared()
+    {
+        static TileCache tileCache;
+        return tileCache;
+    }
+
+    std::shared_ptr<const CellTile> TileCache::GetTile(_In_ const TileKey& tileKey)
+    {
+        {
+            const std::shared_lock<std::shared_mutex> lock(mMutex);
+            const auto found = mTiles.find(tileKey);
+            if (found != mTiles.end())
+                return found->second;
+        }
+
+        // 잠금 밖에서 래스터화하고, 다른 스레드가 먼저 넣었으면 그 타일을 사용
+        std::shared_ptr<const CellTile> cellTile = Rasterize(tileKey);
+        const size_t byteSize = cellTile->mPixels.size() + cellTile->mCoverage.size();
+
+        const std::unique_lock<std::shared_mutex> lock(mMutex);
+        const auto found = mTiles.find(tileKey);
+        if (found != mTiles.end())
+            return found->second;
+
+        // 상한을 넘으면 지금까지의 타일을 모두 내려놓음 (사용 중인 타일은 호출자의 shared_ptr가 유지)
+        if (mByteSize + byteSize > mMaxByteSize)
+        {
+            mTiles.clear();
+            mByteSize = 0;
+        }
+
+        mTiles.emplace(tileKey, cellTile);
+        mByteSize += byteSize;
+        return cellTile;
+    }
+
+    size_t TileCache::GetTileCount() const
+    {
+        const std::shared_lock<std::shared_mutex> lock(mMutex);
+        return mTiles.size();
+    }
+
+    size_t TileCache::GetByteSize() const
+    {
+        const std::shared_lock<std::shared_mutex> lock(mMutex);
+        return mByteSize;
+    }
+
+    void TileCache::Clear()
+    {
+        const std::unique_lock<std::shared_mutex> lock(mMutex);
+        mTiles.clear();
+        mByteSize = 0;
+    }
+
+    RECT TileCache::GetScaledRect(_In_ const size_t cellSize, _In_ const float scale) noexcept
+    {
+        const ScaledShape scaledShape = GetScaledShape(cellSize, scale, 0);
+
+        // 걸치는 픽셀까지 포함하도록 왼쪽/위쪽은 내림, 오른쪽/아래쪽은 올림
+        const LONG first = static_cast<LONG>(scaledShape.mFirst >> subpixelBits);
+        const LONG last = static_cast<LONG>((scaledShape.mLast + (1 << subpixelBits) - 1) >> subpixelBits);
+
+        return {first, first, last, last};
+    }
+
+    std::unique_ptr<CellTile> TileCache::Rasterize(_In_ const TileKey& tileKey)
+    {
+        PRECONDITION(tileKey.mCellSize != 0);
+        PRECONDITION(tileKey.mUpscale != 0);
+        PRECONDITION(0 < tileKey.mScaleStep);
+        PRECONDITION(tileKey.mScaleStep <= TileKey::mScaleSteps);
+
+        std::unique_ptr<CellTile> cellTile = std::make_unique<CellTile>();
+        cellTile->mRect = GetScaledRect(tileKey.mCellSize, tileKey.GetScale());
+
+        const size_t width = static_cast<size_t>(std::max<LONG>(0, cellTile->mRect.right - cellTile->mRect.left));
+        const size_t height = static_cast<size_t>(std::max<LONG>(0, cellTile->mRect.bottom - cellTile->mRect.top));
+
+        // 픽셀마다 8×8 표본 중 셀 안에 든 비율
+        const ScaledShape scaledShape = GetScaledShape(tileKey.mCellSize, tileKey.GetScale(), tileKey.mCornerRadius);
+        constexpr int64_t sampleCount = sampleGrid * sampleGrid;
+        constexpr int64_t sampleStep = (1 << subpixelBits) / sampleGrid;
+
+        bool isOpaque = true;
+        cellTile->mCoverage.resize(width * height);
+        for (size_t row = 0; row < height; ++row)
+        {
+            const int64_t pixelY = static_cast<int64_t>(cellTile->mRect.top + static_cast<LONG>(row)) << subpixelBits;
+            for (size_t column = 0; column < width; ++column)
+            {
+                const int64_t pixelX = static_cast<int64_t>(cellTile->mRect.left + static_cast<LONG>(column)) <<
+                    subpixelBits;
+
+                int64_t insideCount = 0;
+                for (int64_t sampleY = 0; sampleY < sampleGrid; ++sampleY)
+                {
+                    for (int64_t sampleX = 0; sampleX < sampleGrid; ++sampleX)
+                    {
+                        // 표본은 각 부분 칸의 중심
+                        if (IsInside(scaledShape, pixelX + sampleX * sampleStep + sampleStep / 2,
+                                     pixelY + sampleY * sampleStep + sampleStep / 2))
+                            ++insideCount;
+                    }
+                }
+
+                // Indexed8 팔레트(256색)에 셀 색상 × 가장자리 색상이 들어가도록 셀 크기와 관계없이 coverageLevels 단계로 양자화
+                const int64_t level = (insideCount * coverageLevels + sampleCount / 2) / sampleCount;
+                const uint8_t coverage = static_cast<uint8_t>((level * 255 + coverageLevels / 2) / coverageLevels);
+                cellTile->mCoverage[row * width + column] = coverage;
+                isOpaque = isOpaque && coverage == 255;
+            }
+        }
+
+        // 전체가 불투명하면 섞지 않고 복사만 하도록 비움
+        if (isOpaque)
+            cellTile->mCoverage.clear();
+
+        if (tileKey.mPixelFormat == ePixelFormat::Indexed8)
+        {
+            // 색상은 캔버스마다 다른 팔레트 번호로 칠하므로 타일은 모양(영역, 덮는 비율)만 가짐
+            cellTile->mPlaneCount = 0;
+            cellTile->mBytesPerPixel = 1;
+            cellTile->mRowSize = width;
+        }
+        else if (tileKey.mPixelFormat == ePixelFormat::YUV420)
+        {
+            // GridCanvas가 칠하는 평면 순서: Y, R, G, B
+            const COLORREF color = tileKey.mColor;
+            const std::array<uint8_t, 4> planeValues = {
+                PixelKernels::ToLuma(color), GetRValue(color), GetGValue(color), GetBValue(color)
+            };
+
+            cellTile->mPlaneCount = planeValues.size();
+            cellTile->mBytesPerPixel = 1;
+            cellTile->mRowSize = width;
+            cellTile->mPixels.resize(cellTile->mPlaneCount * width * height);
+            for (size_t plane = 0; plane < cellTile->mPlaneCount; ++plane)
+                memset(cellTile->mPixels.data() + plane * width * height, planeValues[plane], width * height);
+        }
+        else
+        {
+            ASSERT(tileKey.mPixelFormat == ePixelFormat::ARGB);
+            cellTile->mPlaneCount = 1;
+            cellTile->mBytesPerPixel = 4;
+            cellTile->mRowSize = width * cellTile->mBytesPerPixel;
+            cellTile->mPixels.resize(cellTile->mRowSize * height);
+            PixelKernels::FillSpan(reinterpret_cast<uint32_t*>(cellTile->mPixels.data()), width * height,
+                                   PixelKernels::ToPixel(tileKey.mColor));
+        }
+
+        if (tileKey.mUpscale > 1)
+            Upscale(*cellTile, tileKey.mUpscale);
+
+        return cellTile;
+    }
+
+    void TileCache::Upscale(_Inout_ CellTile& cellTile, _In_ const size_t upscale)
+    {
+        const size_t width = static_cast<size_t>(std::max<LONG>(0, cellTile.mRect.right - cellTile.mRect.left));
+        const size_t height = static_cast<size_t>(std::max<LONG>(0, cellTile.mRect.bottom - cellTile.mRect.top));
+        const size_t scaledHeight = height * upscale;
+        const size_t scaledRowSize = cellTile.mRowSize * upscale;
+
+        // 한 줄을 가로로 확대한 뒤 같은 줄을 upscale - 1번 더 복사
+        const auto upscaleRows = [&](const uint8_t* source, const size_t rowSize, const size_t bytesPerPixel,
+                                     uint8_t* target)
+        {
+            const size_t targetRowSize = rowSize * upscale;
+            for (size_t row = 0; row < height; ++row, source += rowSize, target += targetRowSize * upscale)
+            {
+                PixelKernels::UpscaleSpan(target, source, width, bytesPerPixel, upscale);
+                for (size_t copy = 1; copy < upscale; ++copy)
+                    memcpy(target + copy * targetRowSize, target, targetRowSize);
+            }
+        };
+
+        std::vector<uint8_t> scaledPixels(cellTile.mPlaneCount * scaledRowSize * scaledHeight);
+        for (size_t plane = 0; plane < cellTile.mPlaneCount; ++plane)
+        {
+            upscaleRows(cellTile.mPixels.data() + plane * cellTile.mRowSize * height, cellTile.mRowSize,
+                        cellTile.mBytesPerPixel, scaledPixels.data() + plane * scaledRowSize * scaledHeight);
+        }
+
+        if (cellTile.mCoverage.empty() == false)
+        {
+            std::vector<uint8_t> scaledCoverage(width * upscale * scaledHeight);
+            upscaleRows(cellTile.mCoverage.data(), width, 1, scaledCoverage.data());
+            cellTile.mCoverage = std::move(scaledCoverage);
+        }
+
+        const LONG scale = static_cast<LONG>(upscale);
+        cellTile.mRect = {
+            cellTile.mRect.left * scale, cellTile.mRect.top * scale, cellTile.mRect.right * scale,
+            cellTile.mRect.bottom * scale
+        };
+        cellTile.mRowSize = scaledRowSize;
+        cellTile.mPixels = std::move(scaledPixels);
+    }
+
+    size_t TileCache::TileKeyHash::operator()(const TileKey& tileKey) const noexcept
+    {
+        size_t hash = std::hash<uint32_t>()(tileKey.mColor);
+        hash = hash * 31 + std::hash<uint32_t>()(tileKey.mScaleStep);
+        hash = hash * 31 + std::hash<size_t>()(tileKey.mCellSize);
+        hash = hash * 31 + std::hash<size_t>()(tileKey.mCornerRadius);
+        hash = hash * 31 + std::hash<size_t>()(tileKey.mUpscale);
+        hash = hash * 31 + static_cast<size_t>(tileKey.mPixelFormat);
+        return hash;
+    }
+} // CoTigraphy
@@ -0,0 +1,166 @@
+﻿// \file TileCache.hpp
+// \last_updated 2026-10-16
+// \author Oh Sungsik <ohsungsik@outlook.com>
+// \copyright (C) 2025. Oh Sungsik. All rights reserved.
+
+#pragma once
+
+#include <cmath>
+#include <memory>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "PixelKernels.hpp"
+
+namespace CoTigraphy
+{
+    /**
+     * @brief 셀 타일 하나를 구분하는 키
+     */
+    struct TileKey
+    {
+        static constexpr uint32_t mScaleSteps = 1 << 16; // 크기 비율 1.0f에 해당하는 mScaleStep
+
+        COLORREF mColor = 0; // 셀 색상
+        uint32_t mScaleStep = mScaleSteps; // 셀 크기 비율 × mScaleSteps (1 ~ mScaleSteps, 정수로 양자화해 비교/해시)
+        size_t mCellSize = 0; // 셀의 한 변 길이 (픽셀 단위)
+        size_t mCornerRadius = 0; // 셀 모서리 반지름 (크기 비율 적용 전 픽셀 단위, 0: 직각)
+        size_t mUpscale = 1; // 논리 픽셀 하나를 채우는 출력 픽셀 블록 크기 (N×N)
+        ePixelFormat mPixelFormat = ePixelFormat::Indexed8; // 타일 픽셀 형식 (캔버스 형식과 같음)
+
+        /**
+         * @brief 셀 크기 비율을 mScaleStep 값으로 양자화
+         * @param scale 셀 크기 비율 (0.0f ~ 1.0f)
+         * @return 가장 가까운 1 / mScaleSteps 단위 값 (같은 값이면 같은 타일)
+         */
+        [[nodiscard]] static uint32_t QuantizeScale(_In_ const float scale) noexcept
+        {
+            return static_cast<uint32_t>(std::lround(static_cast<double>(scale) * mScaleSteps));
+        }
+
+        /**
+         * @brief 양자화한 셀 크기 비율을 반환
+         */
+        [[nodiscard]] float GetScale() const noexcept
+        {
+            return static_cast<float>(mScaleStep) / static_cast<float>(mScaleSteps);
+        }
+
+        [[nodiscard]] bool operator==(const TileKey& rhs) const noexcept
+        {
+            return mColor == rhs.mColor && mScaleStep == rhs.mScaleStep && mCellSize == rhs.mCellSize &&
+                mCornerRadius == rhs.mCornerRadius && mUpscale == rhs.mUpscale && mPixelFormat == rhs.mPixelFormat;
+        }
+    };
+
+    /**
+     * @brief 미리 래스터화된 셀 이미지
+     * @details
+     * - mRect 영역만 픽셀을 가지며, 캔버스에는 셀 왼쪽 위 좌표에 mRect.left/top을 더한 위치부터 줄 단위로 복사
+     * - 평면 형식(YUV420)은 평면마다 mHeight줄씩 이어서 저장 (GridCanvas가 칠하는 평면 순서와 같음)
+     * - mRect, mPixels, mCoverage는 모두 출력 픽셀 기준 (TileKey::mUpscale 배율 적용 후)
+     * - 가장자리가 픽셀 경계에 맞지 않거나 모서리가 둥글면 mCoverage 비율만큼 대상 픽셀과 섞음 (anti-aliasing)
+     */
+    struct CellTile
+    {
+        RECT mRect{}; // 셀 왼쪽 위 기준 타일 영역
+        size_t mPlaneCount = 1; // 평면 수 (ARGB: 1, YUV420: Y + R, G, B = 4, Indexed8: 0 (모양만 보관))
+        size_t mBytesPerPixel = 4; // 평면 하나의 픽셀 크기
+        size_t mRowSize = 0; // 평면 한 줄의 바이트 수
+        std::vector<uint8_t> mPixels; // 평면 순서대로 저장한 타일 픽셀
+        std::vector<uint8_t> mCoverage; // 픽셀마다 셀이 덮는 비율 (0~255, 모든 평면 공통, 비어 있으면 전체 불투명)
+    };
+
+    /**
+     * @brief (색상, 크기 비율, 셀 크기, 모서리 반지름, 픽셀 형식)마다 셀 이미지를 한 번만 래스터화해 보관하는 캐시
+     * @details
+     * - 덮는 비율은 픽셀마다 8×8 표본을 1/256 픽셀 단위 정수 좌표로 검사해 계산 (부동소수점 반올림 차이 없음)
+     * - 덮는 비율은 16단계로 양자화하므로 셀이 커져도 섞인 가장자리 색상 수가 늘지 않음 (Indexed8 팔레트 256색)
+     * - 모양은 항상 논리 해상도(mCellSize)에서 계산하고, mUpscale > 1이면 픽셀마다 N×N 블록으로 확대해 보관
+     * - 한 프로세스 안의 모든 캔버스/작업이 GetShared()로 같은 캐시를 공유 (스레드 안전)
+     * - 보관한 타일의 바이트 수가 상한을 넘으면 모두 비우고 다시 채움 (크기 비율을 양자화하므로 보통은 상한에 닿지 않음)
+     * - GetTile()은 shared_ptr를 반환하므로 캐시가 비워져도 사용 중인 타일은 유효
+     */
+    class TileCache final
+    {
+    public:
+        static constexpr size_t mDefaultMaxByteSize = 64 * 1024 * 1024; // GetShared() 캐시가 보관하는 타일 바이트 수 상한
+
+        /**
+         * @brief 생성자
+         * @param maxByteSize 보관할 타일 픽셀 + 덮는 비율의 바이트 수 상한 (넘으면 Clear() 후 새 타일만 보관)
+         */
+        explicit TileCache(_In_ size_t maxByteSize = mDefaultMaxByteSize) noexcept;
+        TileCache(const TileCache& other) = delete;
+        TileCache(TileCache&& other) = delete;
+
+        TileCache& operator=(const TileCache& rhs) = delete;
+        TileCache& operator=(TileCache&& rhs) = delete;
+
+        ~TileCache();
+
+        /**
+         * @brief 프로세스 전체에서 공유하는 캐시를 반환 (상한 mDefaultMaxByteSize)
+         */
+        [[nodiscard]] static TileCache& GetShared();
+
+        /**
+         * @brief 키에 해당하는 타일을 반환 (없으면 래스터화해 추가)
+         * @param tileKey 타일 키
+         * @pre tileKey.mCellSize > 0 && tileKey.mUpscale > 0 && 0 < tileKey.mScaleStep <= TileKey::mScaleSteps
+         */
+        [[nodiscard]] std::shared_ptr<const CellTile> GetTile(_In_ const TileKey& tileKey);
+
+        /**
+         * @brief 지금까지 만든 타일 수를 반환
+         */
+        [[nodiscard]] size_t GetTileCount() const;
+
+        /**
+         * @brief 보관 중인 타일의 픽셀 + 덮는 비율 바이트 수를 반환
+         */
+        [[nodiscard]] size_t GetByteSize() const;
+
+        /**
+         * @brief 보관 중인 타일을 모두 지움
+         * @details
+         * - 이전에 GetTile()이 반환한 타일은 그 shared_ptr가 남아 있는 동안 유효
+         */
+        void Clear();
+
+        /**
+         * @brief 셀 왼쪽 위 기준으로 크기 비율이 적용된 셀이 걸치는 픽셀 영역을 계산
+         * @param cellSize 셀의 한 변 길이
+         * @param scale 셀 크기 비율
+         * @return 셀 중심을 기준으로 줄인 영역을 바깥쪽 픽셀 경계로 넓힌 영역 (가장자리 픽셀은 일부만 덮일 수 있음)
+         */
+        [[nodiscard]] static RECT GetScaledRect(_In_ const size_t cellSize, _In_ const float scale) noexcept;
+
+    private:
+        /**
+         * @brief 키에 해당하는 타일을 래스터화
+         * @param tileKey 타일 키
+         */
+        [[nodiscard]] static std::unique_ptr<CellTile> Rasterize(_In_ const TileKey& tileKey);
+
+        /**
+         * @brief 논리 해상도 타일의 픽셀과 덮는 비율을 N×N 블록으로 확대
+         * @param cellTile 확대할 타일 (mRect도 출력 픽셀 기준으로 바뀜)
+         * @param upscale 확대 배율
+         */
+        static void Upscale(_Inout_ CellTile& cellTile, _In_ size_t upscale);
+
+    private:
+        struct TileKeyHash
+        {
+            size_t operator()(const TileKey& tileKey) const noexcept;
+        };
+
+        const size_t mMaxByteSize; // 보관할 타일 바이트 수 상한
+
+        mutable std::shared_mutex mMutex; // mTiles, mByteSize 보호 (조회는 공유, 추가는 단독)
+        std::unordered_map<TileKey, std::shared_ptr<const CellTile>, TileKeyHash> mTiles; // 보관 중인 타일
+        size_t mByteSize = 0; // mTiles 타일의 픽셀 + 덮는 비율 바이트 수
+    };
+} // CoTigraphy
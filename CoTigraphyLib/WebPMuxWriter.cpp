@@ -0,0 +1,334 @@
+﻿// \file WebPMuxWriter.cpp
+// \last_updated 2026-10-16
+// \author Oh Sungsik <ohsungsik@outlook.com>
+// \copyright (C) 2025. Oh Sungsik. All rights reserved.
+
+#include "pch.hpp"
+#include "WebPMuxWriter.hpp"
+
+namespace CoTigraphy
+{
+    WebPMuxWriter::WebPMuxWriter() noexcept
+    = default;
+
+    WebPMuxWriter::~WebPMuxWriter()
+    {
+        WebPMemoryWriterClear(&mMemoryWriter);
+        WebPMuxDelete(mMux);
+    }
+
+#pragma warning(disable: 4267)  // conversion from 'size_t' to 'int', possible loss of data)
+    Error WebPMuxWriter::Initialize(_In_ const size_t& width, _In_ const size_t& height)
+    {
+        PRECONDITION(width > 0);
+        PRECONDITION(height > 0);
+        ASSERT(width <= static_cast<size_t>(std::numeric_limits<int>::max()));
+        ASSERT(height <= static_cast<size_t>(std::numeric_limits<int>::max()));
+
+        // 이전 애니메이션의 Mux 정리 (writer 재사용)
+        WebPMuxDelete(mMux);
+        mMux = WebPMuxNew();
+        if (mMux == nullptr)
+            return MAKE_ERROR(eErrorCode::EncodingFailure);
+
+        mEncodedFrame = 0;
+        mHasPendingFrame = false;
+        mWidth = width;
+        mHeight = height;
+        mPixelFormat = GetPixelFormat();
+        mPreviousFrame.resize(mPixelFormat == ePixelFormat::ARGB
+                                  ? width * height * sizeof(uint32_t)
+                                  : width * height + 2 * ((width + 1) / 2) * ((height + 1) / 2));
+
+        if (WebPMuxSetCanvasSize(mMux, static_cast<int>(width), static_cast<int>(height)) != WEBP_MUX_OK)
+            return MAKE_ERROR(eErrorCode::EncodingFailure);
+
+        // WebPAnimEncoder 기본값과 동일 (흰색 배경, 무한 반복)
+        WebPMuxAnimParams animParams;
+        animParams.bgcolor = 0xFFFFFFFF;
+        animParams.loop_count = 0;
+        if (WebPMuxSetAnimationParams(mMux, &animParams) != WEBP_MUX_OK)
+            return MAKE_ERROR(eErrorCode::EncodingFailure);
+
+        WebPMemoryWriterClear(&mMemoryWriter);
+        WebPMemoryWriterInit(&mMemoryWriter);
+
+        // 키프레임/프레임 비교 설정은 WebPAnimEncoder 전용이므로 프레임 인코딩 설정만 적용
+        WebPConfigInit(&mConfig);
+        mEncodeOptions.ApplyTo(mConfig);
+
+        return MAKE_ERROR(eErrorCode::Succeeded);
+    }
+
+    bool WebPMuxWriter::AddFrame(_In_ const uint8_t* const buffer, _In_ const RECT& dirtyRect, _In_ const int durationMs)
+    {
+        PRECONDITION(mMux != nullptr);
+        PRECONDITION(buffer != nullptr);
+        PRECONDITION(durationMs > 0);
+
+        // 바뀐 픽셀이 없으면 인코딩하지 않고 아직 Mux에 넣지 않은 직전 프레임의 표시 시간만 늘림
+        // (AddAnimation()으로 붙인 프레임은 이미 Mux에 들어갔으므로 다음 프레임은 항상 인코딩)
+        if (mHasPendingFrame && IsRectEmpty(&dirtyRect))
+        {
+            mPendingFrameInfo.duration += durationMs;
+            return true;
+        }
+
+        // 직전 프레임이 AddFrame()으로 들어왔으면 바뀐 영역만 비교, 아니면 비교 없이 캔버스 전체를 사본으로 보관
+        const RECT canvasRect = {0, 0, static_cast<LONG>(mWidth), static_cast<LONG>(mHeight)};
+        RECT compareRect = canvasRect;
+        if (mHasPendingFrame)
+            IntersectRect(&compareRect, &dirtyRect, &canvasRect);
+
+        const bool isChanged = UpdatePreviousFrame(buffer, compareRect);
+        if (mHasPendingFrame && isChanged == false)
+        {
+            mPendingFrameInfo.duration += durationMs;
+            return true;
+        }
+
+        if (FlushPendingFrame() == false)
+            return false;
+
+        // 첫 프레임은 캔버스 전체가 기준 이미지
+        const RECT frameRect = (mEncodedFrame == 0)
+                                   ? RECT{0, 0, static_cast<LONG>(mWidth), static_cast<LONG>(mHeight)}
+                                   : AlignFrameRect(dirtyRect);
+
+        WebPPicture picture;
+        int ret = WebPPictureInit(&picture);
+        ASSERT(ret != 0);
+        picture.width = frameRect.right - frameRect.left;
+        picture.height = frameRect.bottom - frameRect.top;
+
+        const size_t frameOffset = static_cast<size_t>(frameRect.top) * mWidth + static_cast<size_t>(frameRect.left);
+        if (mPixelFormat == ePixelFormat::ARGB)
+        {
+            // 무손실은 변경 영역을 가리키는 ARGB view로 인코딩 (복사 없음, 불투명 캔버스이므로 WebPEncode()는 픽셀을 바꾸지 않음)
+            picture.use_argb = 1;
+            picture.argb = reinterpret_cast<uint32_t*>(const_cast<uint8_t*>(buffer)) + frameOffset;
+            picture.argb_stride = static_cast<int>(mWidth);
+        }
+        else
+        {
+            // 변경 영역을 가리키는 Y/U/V view로 인코딩 (RGB -> YUV 변환/복사 없음, WebPEncode()는 평면을 읽기만 함)
+            // frameRect의 왼쪽/위쪽은 짝수이므로 U, V는 (left / 2, top / 2) 블록부터 시작
+            uint8_t* const luma = const_cast<uint8_t*>(buffer);
+            const size_t chromaWidth = (mWidth + 1) / 2;
+            const size_t chromaSize = chromaWidth * ((mHeight + 1) / 2);
+            const size_t chromaOffset = static_cast<size_t>(frameRect.top / 2) * chromaWidth +
+                static_cast<size_t>(frameRect.left / 2);
+
+            picture.use_argb = 0;
+            picture.colorspace = WEBP_YUV420;
+            picture.y = luma + frameOffset;
+            picture.u = luma + mWidth * mHeight + chromaOffset;
+            picture.v = luma + mWidth * mHeight + chromaSize + chromaOffset;
+            picture.y_stride = static_cast<int>(mWidth);
+            picture.uv_stride = static_cast<int>(chromaWidth);
+        }
+
+        // 이전 프레임의 인코딩 메모리를 재사용 (직전 프레임은 FlushPendingFrame()에서 Mux로 복사됨)
+        mMemoryWriter.size = 0;
+        picture.writer = WebPMemoryWrite;
+        picture.custom_ptr = &mMemoryWriter;
+
+        ret = WebPEncode(&mConfig, &picture);
+        WebPPictureFree(&picture);
+        if (ret == 0)
+            return false;
+
+        // 부분 이미지를 ANMF 프레임으로 준비 (영역 밖은 이전 프레임 유지)
+        // 다음 프레임이 같으면 표시 시간이 늘어나므로 다음 프레임을 인코딩하거나 Assemble()할 때 Mux에 넣음
+        mPendingFrameInfo = WebPMuxFrameInfo{};
+        mPendingFrameInfo.bitstream.bytes = mMemoryWriter.mem;
+        mPendingFrameInfo.bitstream.size = mMemoryWriter.size;
+        mPendingFrameInfo.id = WEBP_CHUNK_ANMF;
+        mPendingFrameInfo.x_offset = frameRect.left;
+        mPendingFrameInfo.y_offset = frameRect.top;
+        mPendingFrameInfo.duration = durationMs;
+        mPendingFrameInfo.dispose_method = WEBP_MUX_DISPOSE_NONE;
+        mPendingFrameInfo.blend_method = WEBP_MUX_NO_BLEND;
+        mHasPendingFrame = true;
+
+        mEncodedFrame++;
+
+        return true;
+    }
+
+    bool WebPMuxWriter::UpdatePreviousFrame(_In_ const uint8_t* const buffer, _In_ const RECT& rect)
+    {
+        if (IsRectEmpty(&rect))
+            return false;
+
+        PRECONDITION(0 <= rect.left && 0 <= rect.top);
+        PRECONDITION(static_cast<size_t>(rect.right) <= mWidth);
+        PRECONDITION(static_cast<size_t>(rect.bottom) <= mHeight);
+
+        bool isChanged = false;
+        const auto updatePlane = [this, buffer, &isChanged](const size_t planeOffset, const size_t stride,
+                                                           const size_t left, const size_t top, const size_t right,
+                                                           const size_t bottom)
+        {
+            for (size_t row = top; row < bottom; ++row)
+            {
+                const size_t offset = planeOffset + row * stride + left;
+                if (memcmp(mPreviousFrame.data() + offset, buffer + offset, right - left) != 0)
+                {
+                    memcpy(mPreviousFrame.data() + offset, buffer + offset, right - left);
+                    isChanged = true;
+                }
+            }
+        };
+
+        const size_t left = static_cast<size_t>(rect.left);
+        const size_t top = static_cast<size_t>(rect.top);
+        const size_t right = static_cast<size_t>(rect.right);
+        const size_t bottom = static_cast<size_t>(rect.bottom);
+        if (mPixelFormat == ePixelFormat::ARGB)
+        {
+            constexpr size_t bytesPerPixel = sizeof(uint32_t);
+            updatePlane(0, mWidth * bytesPerPixel, left * bytesPerPixel, top, right * bytesPerPixel, bottom);
+            return isChanged;
+        }
+
+        // Y 평면은 rect 그대로, U, V 평면은 rect와 겹치는 2×2 블록
+        const size_t chromaWidth = (mWidth + 1) / 2;
+        const size_t chromaSize = chromaWidth * ((mHeight + 1) / 2);
+        updatePlane(0, mWidth, left, top, right, bottom);
+        updatePlane(mWidth * mHeight, chromaWidth, left / 2, top / 2, (right + 1) / 2, (bottom + 1) / 2);
+        updatePlane(mWidth * mHeight + chromaSize, chromaWidth, left / 2, top / 2, (right + 1) / 2, (bottom + 1) / 2);
+
+        return isChanged;
+    }
+
+    bool WebPMuxWriter::AddAnimation(_In_ const std::vector<uint8_t>& webpData, _In_ const int stillImageDurationMs)
+    {
+        PRECONDITION(mMux != nullptr);
+        PRECONDITION(webpData.empty() == false);
+
+        if (FlushPendingFrame() == false)
+            return false;
+
+        WebPData sourceData;
+        sourceData.bytes = webpData.data();
+        sourceData.size = webpData.size();
+
+        WebPMux* const sourceMux = WebPMuxCreate(&sourceData, 0);
+        if (sourceMux == nullptr)
+            return false;
+
+        int width = 0;
+        int height = 0;
+        WebPMuxError muxError = WebPMuxGetCanvasSize(sourceMux, &width, &height);
+        if (muxError != WEBP_MUX_OK || static_cast<size_t>(width) != mWidth || static_cast<size_t>(height) != mHeight)
+        {
+            WebPMuxDelete(sourceMux);
+            return false;
+        }
+
+        int frameCount = 0;
+        muxError = WebPMuxNumChunks(sourceMux, WEBP_CHUNK_ANMF, &frameCount);
+        if (muxError != WEBP_MUX_OK)
+        {
+            WebPMuxDelete(sourceMux);
+            return false;
+        }
+
+        // 정지 이미지는 이미지 하나를 프레임 하나로 취급
+        const bool isStillImage = (frameCount == 0);
+        if (isStillImage)
+            frameCount = 1;
+
+        bool succeeded = true;
+        for (int frameIndex = 1; frameIndex <= frameCount && succeeded; ++frameIndex)
+        {
+            // bitstream은 단일 이미지 WebP로 만들어져 반환됨 (재인코딩 없음)
+            WebPMuxFrameInfo frameInfo;
+            muxError = WebPMuxGetFrame(sourceMux, frameIndex, &frameInfo);
+            if (muxError != WEBP_MUX_OK)
+            {
+                succeeded = false;
+                break;
+            }
+
+            if (isStillImage)
+            {
+                frameInfo.x_offset = 0;
+                frameInfo.y_offset = 0;
+                frameInfo.duration = stillImageDurationMs;
+                frameInfo.dispose_method = WEBP_MUX_DISPOSE_NONE;
+                frameInfo.blend_method = WEBP_MUX_NO_BLEND;
+            }
+            frameInfo.id = WEBP_CHUNK_ANMF;
+
+            muxError = WebPMuxPushFrame(mMux, &frameInfo, 1);
+            WebPDataClear(&frameInfo.bitstream);
+
+            succeeded = (muxError == WEBP_MUX_OK);
+            if (succeeded)
+                mEncodedFrame++;
+        }
+
+        WebPMuxDelete(sourceMux);
+
+        return succeeded;
+    }
+
+    Error WebPMuxWriter::Assemble(_Out_ std::vector<uint8_t>& outData)
+    {
+        PRECONDITION(mMux != nullptr);
+        PRECONDITION(mEncodedFrame > 0);
+
+        outData.clear();
+
+        if (FlushPendingFrame() == false)
+            return MAKE_ERROR(eErrorCode::EncodingFailure);
+
+        // WebP 애니메이션 출력
+        WebPData webpData;
+        WebPDataInit(&webpData);
+        const WebPMuxError muxError = WebPMuxAssemble(mMux, &webpData);
+        if (muxError != WEBP_MUX_OK)
+            return MAKE_ERROR(eErrorCode::EncodingFailure);
+
+        outData.assign(webpData.bytes, webpData.bytes + webpData.size);
+
+        // WebP 데이터 정리
+        WebPDataClear(&webpData);
+
+        return MAKE_ERROR(eErrorCode::Succeeded);
+    }
+
+    bool WebPMuxWriter::FlushPendingFrame()
+    {
+        if (mHasPendingFrame == false)
+            return true;
+
+        mHasPendingFrame = false;
+
+        return WebPMuxPushFrame(mMux, &mPendingFrameInfo, 1) == WEBP_MUX_OK;
+    }
+
+    RECT WebPMuxWriter::AlignFrameRect(_In_ const RECT& dirtyRect) const noexcept
+    {
+        const LONG width = static_cast<LONG>(mWidth);
+        const LONG height = static_cast<LONG>(mHeight);
+
+        RECT rect;
+        rect.left = std::max<LONG>(0, dirtyRect.left);
+        rect.top = std::max<LONG>(0, dirtyRect.top);
+        rect.right = std::min(width, dirtyRect.right);
+        rect.bottom = std::min(height, dirtyRect.bottom);
+
+        // 바뀐 픽셀이 없어도 프레임 타이밍을 유지하기 위해 최소 영역을 인코딩
+        if (rect.left >= rect.right || rect.top >= rect.bottom)
+            rect = {0, 0, std::min<LONG>(2, width), std::min<LONG>(2, height)};
+
+        // ANMF의 X/Y offset은 2로 나눈 값으로 저장되므로 짝수로 내림
+        rect.left &= ~1;
+        rect.top &= ~1;
+
+        return rect;
+    }
+} // CoTigraphy
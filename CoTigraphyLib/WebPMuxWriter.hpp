@@ -0,0 +1,132 @@
+﻿// \file WebPMuxWriter.hpp
+// \last_updated 2026-10-16
+// \author Oh Sungsik <ohsungsik@outlook.com>
+// \copyright (C) 2025. Oh Sungsik. All rights reserved.
+
+#pragma once
+
+#include <webp/encode.h>
+#include <webp/mux.h>
+
+#include "FrameWriter.hpp"
+
+namespace CoTigraphy
+{
+    /**
+     * @brief 변경 영역만 인코딩해 ANMF 프레임으로 조립하는 WebP 애니메이션 writer
+     * @details
+     * - WebPAnimEncoder의 프레임 간 비교를 거치지 않고, 호출자가 알려준 dirtyRect만 WebPEncode로 인코딩
+     * - 인코딩된 부분 이미지를 WebPMuxPushFrame으로 (x, y) offset을 지정해 ANMF 프레임으로 추가
+     * - 모든 프레임은 NO_BLEND + DISPOSE_NONE이므로 영역 밖의 픽셀은 이전 프레임이 그대로 유지됨
+     * - 프레임당 인코딩 비용은 캔버스 크기가 아니라 변경 영역 크기에 비례
+     * - Initialize -> AddFrame 반복 -> SaveToFile 순으로 사용
+     * - AddAnimation()으로 따로 인코딩된 애니메이션의 프레임을 이어 붙일 수 있음 (병렬 chunk 인코딩 결과 조립)
+     */
+    class WebPMuxWriter final : public FrameWriter
+    {
+    public:
+        explicit WebPMuxWriter() noexcept;
+
+        WebPMuxWriter(const WebPMuxWriter& other) = delete;
+        WebPMuxWriter(WebPMuxWriter&& other) = delete;
+
+        WebPMuxWriter& operator=(const WebPMuxWriter& rhs) = delete;
+        WebPMuxWriter& operator=(WebPMuxWriter&& rhs) = delete;
+
+        ~WebPMuxWriter() override;
+
+        /**
+         * @brief 새 애니메이션을 시작하고 캔버스 크기 지정
+         * @param width 출력 애니메이션 가로 해상도 (픽셀)
+         * @param height 출력 애니메이션 세로 해상도 (픽셀)
+         * @return 성공 시 Succeeded, Mux를 만들거나 캔버스/애니메이션 설정에 실패하면 EncodingFailure
+         * @pre width > 0 && height > 0
+         * @post 성공하면 내부 Mux가 초기화되고 프레임 추가 가능 상태가 됨
+         */
+        [[nodiscard]] Error Initialize(_In_ const size_t& width, _In_ const size_t& height) override;
+
+        /**
+         * @brief 프레임의 변경 영역만 인코딩해 애니메이션에 추가
+         * @param buffer GetPixelFormat() 형식의 캔버스 전체 픽셀 데이터 (변경 영역의 Y/U/V 평면 또는 ARGB를 복사 없이 인코딩)
+         * @param dirtyRect 직전 프레임 대비 바뀐 영역
+         * @param durationMs 이 프레임의 표시 시간 (ms)
+         * @return 성공 여부 (true = 성공, false = 실패)
+         * @pre Initialize() 이후에만 호출 가능
+         * @details
+         * - 첫 프레임은 dirtyRect와 관계없이 캔버스 전체를 인코딩
+         * - 직전 프레임과 같으면 (빈 dirtyRect 또는 dirtyRect 안의 픽셀이 모두 같으면) 인코딩하지 않고 직전 프레임의 재생 시간을 늘림
+         * - ANMF offset은 2의 배수여야 하므로 영역의 왼쪽/위쪽만 짝수 좌표로 내림 (오른쪽/아래쪽은 캔버스 안으로 자르기만 함)
+         * - 왼쪽/위쪽이 짝수이므로 U, V 평면은 (left / 2, top / 2) 블록부터 그대로 가리킬 수 있음
+         */
+        bool AddFrame(_In_ const uint8_t* const buffer, _In_ const RECT& dirtyRect, _In_ const int durationMs) override;
+
+        /**
+         * @brief 이미 인코딩된 WebP 애니메이션의 모든 프레임을 재인코딩 없이 뒤에 이어 붙임
+         * @param webpData 같은 캔버스 크기로 인코딩된 WebP 파일 내용
+         * @param stillImageDurationMs webpData가 프레임 하나짜리 정지 이미지로 조립된 경우 사용할 재생 시간
+         * @return 성공 여부 (webpData를 해석할 수 없거나 캔버스 크기가 다르면 false)
+         * @pre Initialize() 이후에만 호출 가능
+         * @details
+         * - ANMF 프레임의 offset, 재생 시간, blend/dispose 방식을 그대로 유지
+         * - WebPAnimEncoder는 프레임이 하나뿐이면 정지 이미지로 조립하므로 재생 시간을 따로 받음
+         */
+        bool AddAnimation(_In_ const std::vector<uint8_t>& webpData, _In_ const int stillImageDurationMs);
+
+        /**
+         * @brief 지금까지 추가된 프레임을 WebP 애니메이션으로 조립
+         * @param[out] outData WebP 파일 내용
+         * @return 성공 시 Succeeded, 실패 시 EncodingFailure
+         * @pre 최소 1개의 프레임이 AddFrame()/AddAnimation()을 통해 등록되어 있어야 함
+         */
+        [[nodiscard]] Error Assemble(_Out_ std::vector<uint8_t>& outData) override;
+
+        /**
+         * @brief 인코딩 설정에 맞는 입력 형식을 반환
+         * @return 손실: ePixelFormat::YUV420 (RGB -> YUV 변환 생략), 무손실: ePixelFormat::ARGB (VP8L 입력, YUV420을 거치지 않아 색차 손실 없음)
+         */
+        [[nodiscard]] ePixelFormat GetPixelFormat() const noexcept override
+        {
+            return mEncodeOptions.mLossless ? ePixelFormat::ARGB : ePixelFormat::YUV420;
+        }
+
+        /**
+         * @brief L".webp"를 반환
+         */
+        [[nodiscard]] const wchar_t* GetFileExtension() const noexcept override { return L".webp"; }
+
+    private:
+        /**
+         * @brief AddFrame()에서 인코딩해 두고 재생 시간이 정해지기를 기다리던 프레임을 Mux에 추가
+         * @return 성공 여부 (대기 중인 프레임이 없으면 true)
+         */
+        [[nodiscard]] bool FlushPendingFrame();
+
+        /**
+         * @brief rect와 겹치는 줄(YUV420은 Y 줄과 U, V 블록 줄)을 직전 프레임 사본(mPreviousFrame)과 비교하고 사본을 갱신
+         * @param buffer mPixelFormat 형식의 캔버스 전체 픽셀 데이터
+         * @param rect 비교할 영역 (캔버스 안쪽)
+         * @return rect 안에 직전 프레임과 다른 바이트가 있으면 true
+         */
+        [[nodiscard]] bool UpdatePreviousFrame(_In_ const uint8_t* const buffer, _In_ const RECT& rect);
+
+        /**
+         * @brief 변경 영역을 ANMF offset 규칙에 맞게 보정
+         * @param dirtyRect 직전 프레임 대비 바뀐 영역
+         * @return 캔버스 안쪽으로 자르고 경계를 짝수로 맞춘 영역 (빈 영역이면 왼쪽 위 2x2, 캔버스 끝은 홀수 가능)
+         */
+        [[nodiscard]] RECT AlignFrameRect(_In_ const RECT& dirtyRect) const noexcept;
+
+    private:
+        size_t mWidth = 0; // 캔버스 가로 해상도
+        size_t mHeight = 0; // 캔버스 세로 해상도
+        ePixelFormat mPixelFormat = ePixelFormat::YUV420; // Initialize() 시점의 GetPixelFormat()
+        size_t mEncodedFrame = 0; // 현재까지 인코딩된 프레임 수
+        bool mHasPendingFrame = false; // mPendingFrameInfo가 아직 Mux에 추가되지 않았는지 여부
+        WebPMuxFrameInfo mPendingFrameInfo{}; // 마지막으로 인코딩한 프레임 (bitstream은 mMemoryWriter를 가리킴)
+
+        WebPMux* mMux = nullptr; // libwebp Mux 핸들
+        WebPConfig mConfig{}; // WebP 인코딩 설정 정보
+        WebPMemoryWriter mMemoryWriter{}; // 부분 이미지 인코딩 결과 (프레임 간 재사용)
+        std::vector<uint8_t> mPreviousFrame; // 마지막 AddFrame()의 캔버스 사본 (바뀐 영역만 갱신)
+    };
+} // CoTigraphy
@@ -1,18 +1,26 @@
 ﻿// \file WebPWriter.cpp
-// \last_updated 2025-06-14
+// \last_updated 2026-10-16
 // \author Oh Sungsik <ohsungsik@outlook.com>
 // \copyright (C) 2025. Oh Sungsik. All rights reserved.
 
 #include "pch.hpp"
 #include "WebPWriter.hpp"
 
-#include <filesystem>
 #include <set>
 #include <webp/encode.h>
 #include <webp/mux.h>
 
+#include "PixelKernels.hpp"
+
 namespace CoTigraphy
 {
+    namespace
+    {
+        // method(0 ~ 6) -> 같은 method를 쓰는 가장 높은 WebPConfigLosslessPreset() level
+        // (VP8L에서 quality는 화질이 아니라 압축 노력이므로 method 하나로 속도/크기를 정함)
+        constexpr int losslessLevels[] = {0, 2, 3, 5, 7, 8, 9};
+    }
+
     WebPWriter::WebPWriter() noexcept
     = default;
 
@@ -23,128 +31,124 @@ namespace CoTigraphy
     }
 
 #pragma warning(disable: 4267)  // conversion from 'size_t' to 'int', possible loss of data)
-    void WebPWriter::Initialize(_In_ const size_t& width, _In_ const size_t& height)
+    Error WebPWriter::Initialize(_In_ const size_t& width, _In_ const size_t& height)
     {
         ASSERT(width <= static_cast<size_t>(std::numeric_limits<int>::max()));
         ASSERT(height <= static_cast<size_t>(std::numeric_limits<int>::max()));
 
+        // 이전 애니메이션의 Encoder 정리 (writer 재사용)
+        WebPAnimEncoderDelete(mEncoder);
+        mEncoder = nullptr;
+        mEncodedFrame = 0;
+        mTimestampMs = 0;
+        mRowPixels.resize(width);
+
         WebPAnimEncoderOptions encoderOptions;
         WebPAnimEncoderOptionsInit(&encoderOptions);
+        mEncodeOptions.ApplyTo(encoderOptions);
 
         mEncoder = WebPAnimEncoderNew(static_cast<int>(width), static_cast<int>(height), &encoderOptions);
+        if (mEncoder == nullptr)
+            return MAKE_ERROR(eErrorCode::EncodingFailure);
 
+        WebPPictureFree(&mPicture);
         WebPPictureInit(&mPicture);
         mPicture.width = static_cast<int>(width);
         mPicture.height = static_cast<int>(height);
         mPicture.use_argb = 1;
+        if (WebPPictureAlloc(&mPicture) == 0)
+            return MAKE_ERROR(eErrorCode::EncodingFailure);
 
         WebPConfigInit(&mConfig);
-        mConfig.quality = 90.0f;
+        mEncodeOptions.ApplyTo(mConfig);
+
+        // 캔버스는 최대 256색 팔레트로만 그려지므로 VP8L이 프레임마다 색상 인덱싱 변환으로 그대로 담을 수 있음
+        // (손실 VP8은 셀 경계를 흐리면서도 더 큼, 샘플 캘린더 기준 약 1/5 크기)
+        if (mEncodeOptions.mPaletteLossless)
+        {
+            ASSERT(mEncodeOptions.mMethod >= 0 && mEncodeOptions.mMethod < static_cast<int>(std::size(losslessLevels)));
+            const int ret = WebPConfigLosslessPreset(&mConfig, losslessLevels[mEncodeOptions.mMethod]);
+            ASSERT(ret != 0);
+        }
 
-        POSTCONDITION(mEncoder != nullptr);
+        return MAKE_ERROR(eErrorCode::Succeeded);
     }
 
-    bool WebPWriter::AddFrame(_In_ const uint8_t* const buffer)
+    bool WebPWriter::AddFrame(_In_ const uint8_t* const buffer, _In_ const RECT& dirtyRect, _In_ const int durationMs)
     {
-        // RGBA → WebPPicture 로 변환
-        int ret = WebPPictureImportRGBA(&mPicture, buffer, mPicture.width * 4);
-        ASSERT(ret != 0);
-
-        // 프레임 추가
-        ret = WebPAnimEncoderAdd(mEncoder, &mPicture, static_cast<int>(mEncodedFrame * mFrameDelayMs), &mConfig);
-        ASSERT(ret != 0);
+        PRECONDITION(mPicture.argb != nullptr);
+        PRECONDITION(durationMs > 0);
 
-        mEncodedFrame++;
+        const size_t width = static_cast<size_t>(mPicture.width);
+        const size_t height = static_cast<size_t>(mPicture.height);
+        const uint32_t* const palette = reinterpret_cast<const uint32_t*>(
+            buffer + PixelKernels::GetPaletteOffset(width * height));
 
-        return true;
-    }
+        // 바뀐 픽셀이 없으면 인코딩하지 않고 다음 타임스탬프만 늦춰 직전 프레임을 그만큼 더 보여줌
+        // (팔레트 색상은 등록 후 바뀌지 않으므로 팔레트 번호가 같으면 화면도 같음)
+        if (mEncodedFrame > 0 && IsRectEmpty(&dirtyRect))
+        {
+            mTimestampMs += durationMs;
+            return true;
+        }
 
-    Error WebPWriter::SaveToFile(_In_ const std::wstring& fileName) const
-    {
-        PRECONDITION(fileName.empty() == false);
+        // 첫 프레임은 전체, 이후에는 바뀐 영역만 팔레트 번호 -> ARGB로 펼침 (나머지는 직전 프레임 그대로)
+        RECT expandRect = dirtyRect;
+        if (mEncodedFrame == 0)
+            expandRect = {0, 0, mPicture.width, mPicture.height};
 
-        const std::filesystem::path path(fileName);
-        // 확장자가 유효한지 확인, 대소문자 무시
-        if (_wcsicmp(path.extension().c_str(), L".webp") != 0)
+        // 펼친 줄을 mPicture에 남아 있는 직전 프레임과 비교해 다른 줄만 갱신
+        const size_t expandWidth = static_cast<size_t>(expandRect.right - expandRect.left);
+        bool isChanged = (mEncodedFrame == 0);
+        for (LONG yPos = expandRect.top; yPos < expandRect.bottom; ++yPos)
         {
-            return MAKE_ERROR(eErrorCode::InvalidFileExtension);
+            const size_t offset = static_cast<size_t>(yPos) * width + static_cast<size_t>(expandRect.left);
+            PixelKernels::ExpandIndexedSpan(mRowPixels.data(), buffer + offset, expandWidth, palette);
+
+            uint32_t* const pictureRow = mPicture.argb + static_cast<size_t>(yPos) * mPicture.argb_stride +
+                static_cast<size_t>(expandRect.left);
+            if (memcmp(pictureRow, mRowPixels.data(), expandWidth * sizeof(uint32_t)) != 0)
+            {
+                memcpy(pictureRow, mRowPixels.data(), expandWidth * sizeof(uint32_t));
+                isChanged = true;
+            }
         }
 
-        // 파일 이름 (확장자 제외)이 비었는지 확인
-        if (path.stem().empty())
+        // 바뀐 영역을 다시 그렸지만 결과가 직전 프레임과 같으면 인코딩하지 않음
+        if (isChanged == false)
         {
-            return MAKE_ERROR(eErrorCode::MissingFileName);
+            mTimestampMs += durationMs;
+            return true;
         }
 
+        // 프레임 추가 (WebPAnimEncoderAdd()는 picture를 읽어 내부 캔버스로 복사할 뿐 버퍼를 바꾸지 않음)
+        if (WebPAnimEncoderAdd(mEncoder, &mPicture, mTimestampMs, &mConfig) == 0)
+            return false;
+
+        mTimestampMs += durationMs;
+        mEncodedFrame++;
+
+        return true;
+    }
+
+    Error WebPWriter::Assemble(_Out_ std::vector<uint8_t>& outData)
+    {
+        outData.clear();
+
         // 마지막 frame 마킹
-        int ret = WebPAnimEncoderAdd(mEncoder, nullptr, static_cast<int>(mEncodedFrame * mFrameDelayMs), nullptr);
-        ASSERT(ret != 0);
+        if (WebPAnimEncoderAdd(mEncoder, nullptr, mTimestampMs, nullptr) == 0)
+            return MAKE_ERROR(eErrorCode::EncodingFailure);
 
         // WebP 애니메이션 출력
         WebPData webpData;
         WebPDataInit(&webpData);
-        ret = WebPAnimEncoderAssemble(mEncoder, &webpData);
-        ASSERT(ret != 0);
-
-        // 파일로 저장
-        const HANDLE hFile = CreateFileW(
-            fileName.c_str(), // 파일 이름
-            GENERIC_WRITE, // 쓰기 권한
-            0, // 공유 모드 없음
-            nullptr, // 보안 속성
-            CREATE_ALWAYS, // 항상 새로 생성
-            FILE_ATTRIBUTE_NORMAL, // 일반 파일 속성
-            nullptr // 템플릿 파일 없음
-        );
-
-        // 파일 생성 성공 여부 확인
-        if (hFile == INVALID_HANDLE_VALUE)
-        {
-            return MAKE_ERROR_FROM_LAST_WIN32_ERROR();
-        }
+        if (WebPAnimEncoderAssemble(mEncoder, &webpData) == 0)
+            return MAKE_ERROR(eErrorCode::EncodingFailure);
 
         // 데이터가 유효한지 확인
         ASSERT(webpData.bytes != nullptr);
         ASSERT(webpData.size > 0);
-
-        // 파일에 데이터 쓰기
-        size_t totalWritten = 0;
-        const BYTE* buffer = webpData.bytes;
-        const size_t totalSize = webpData.size;
-
-        // 네트워크 드라이브 디스크에서 간혹 한번에 안써지는 경우가 발생..
-        // 따라서 모든 데이터를 다 쓸떄 까지 반복하여 쓰기 시도
-        while (totalWritten < totalSize)
-        {
-            DWORD bytesWritten = 0;
-
-            // 한 번에 WriteFile이 처리 가능한 최대 크기 계산
-            const DWORD chunkSize = static_cast<DWORD>(
-                std::min<size_t>(totalSize - totalWritten, static_cast<size_t>(MAXDWORD))
-            );
-
-            const BOOL writeResult = WriteFile(
-                hFile,
-                buffer + totalWritten,
-                chunkSize,
-                &bytesWritten,
-                nullptr
-            );
-
-            if (!writeResult)
-            {
-                // 실패 처리
-                CloseHandle(hFile);
-                WebPDataClear(&webpData);
-                return MAKE_ERROR(eErrorCode::FileIOFailure);
-            }
-
-            totalWritten += bytesWritten;
-        }
-
-        // 파일 핸들 정리
-        const BOOL closeResult = CloseHandle(hFile);
-        ASSERT(closeResult != FALSE);
+        outData.assign(webpData.bytes, webpData.bytes + webpData.size);
 
         // WebP 데이터 정리
         WebPDataClear(&webpData);
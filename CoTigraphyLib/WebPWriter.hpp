@@ -1,5 +1,5 @@
 ﻿// \file WebPWriter.hpp
-// \last_updated 2025-06-14
+// \last_updated 2026-10-16
 // \author Oh Sungsik <ohsungsik@outlook.com>
 // \copyright (C) 2025. Oh Sungsik. All rights reserved.
 
@@ -8,16 +8,22 @@
 #include <webp/encode.h>
 #include <webp/mux.h>
 
+#include "FrameWriter.hpp"
+
 namespace CoTigraphy
 {
     /**
      * @brief WebP 애니메이션 프레임을 생성하고 저장하는 클래스
      * @details
-     * - libwebp를 이용하여 RGBA 버퍼 데이터를 WebP 애니메이션으로 저장
-     * - 프레임 단위로 RGBA 데이터를 입력받아 애니메이션을 구성
+     * - libwebp를 이용하여 팔레트 번호(Indexed8) 버퍼 데이터를 WebP 애니메이션으로 저장
+     * - 캔버스는 픽셀당 1바이트로 그리고, 인코딩 직전에 dirtyRect 영역만 유지 중인 ARGB WebPPicture로 펼침
+     * - 팔레트는 GridCanvas가 색상을 그리기 전에 한 번만 등록하고, 기본 설정(EncodeOptions::mPaletteLossless)은
+     *   프레임을 VP8L 무손실로 인코딩해 원본 픽셀을 그대로 보존
      * - Initialize -> AddFrame 반복 -> SaveToFile 순으로 사용
+     * - 인코딩할 변경 영역은 WebPAnimEncoder가 직전 프레임과 비교해 직접 계산
+     * - 직전 프레임과 같은 프레임(빈 dirtyRect 또는 dirtyRect 안의 픽셀이 모두 같은 프레임)은 인코딩하지 않고 직전 프레임의 표시 시간을 늘림
      */
-    class WebPWriter final
+    class WebPWriter final : public FrameWriter
     {
     public:
         explicit WebPWriter() noexcept;
@@ -28,40 +34,56 @@ namespace CoTigraphy
         WebPWriter& operator=(const WebPWriter& rhs) = delete;
         WebPWriter& operator=(WebPWriter&& rhs) = delete;
 
-        ~WebPWriter();
+        ~WebPWriter() override;
 
         /**
          * @brief WebPWriter를 초기화하고 버퍼 크기 지정
          * @param width 출력 애니메이션 가로 해상도 (픽셀)
          * @param height 출력 애니메이션 세로 해상도 (픽셀)
+         * @return 성공 시 Succeeded, WebPAnimEncoder 또는 picture 버퍼를 만들 수 없으면 EncodingFailure
          * @pre width > 0 && height > 0
-         * @post 내부 Encoder가 초기화되고 프레임 추가 가능 상태가 됨
+         * @post 성공하면 내부 Encoder가 초기화되고 프레임 추가 가능 상태가 됨
+         * @details
+         * - SaveToFile() 이후 다시 호출하면 이전 Encoder를 해제하고 새 애니메이션을 시작
          */
-        void Initialize(_In_ const size_t& width, _In_ const size_t& height);
+        [[nodiscard]] Error Initialize(_In_ const size_t& width, _In_ const size_t& height) override;
 
         /**
-         * @brief RGBA 프레임을 애니메이션에 추가
-         * @param buffer RGBA8888 (4바이트) 포맷의 프레임 픽셀 데이터
+         * @brief Indexed8 프레임을 애니메이션에 추가
+         * @param buffer ePixelFormat::Indexed8 (팔레트 번호 + ARGB 팔레트) 형식의 프레임 데이터
+         * @param dirtyRect 직전 프레임에서 바뀐 영역 (이 영역만 ARGB로 펼침, Initialize() 후 첫 프레임은 전체)
+         * @param durationMs 이 프레임의 표시 시간 (ms)
          * @return 성공 여부 (true = 성공, false = 실패)
          * @pre Initialize() 이후에만 호출 가능
-         * @post 내부 애니메이션 프레임이 1개 추가됨
-         * @warning buffer 크기는 width × height × 4 바이트이어야 함
+         * @post 내부 애니메이션 프레임이 1개 추가되거나, 직전 프레임과 같으면 직전 프레임의 표시 시간이 durationMs만큼 늘어남
+         * @warning buffer 크기는 PixelKernels::GetPaletteOffset(width × height) + 256 × 4 바이트이어야 함
          */
-        bool AddFrame(_In_ const uint8_t* const buffer);
+        bool AddFrame(_In_ const uint8_t* const buffer, _In_ const RECT& dirtyRect, _In_ const int durationMs) override;
 
         /**
-         * @brief 지금까지 추가된 프레임을 WebP 애니메이션으로 저장
-         * @param fileName 저장할 파일 경로 (.webp 확장자 권장)
+         * @brief 지금까지 추가된 프레임을 WebP 애니메이션으로 조립
+         * @param[out] outData WebP 파일 내용
+         * @return 성공 시 Succeeded, 실패 시 EncodingFailure
          * @pre 최소 1개의 프레임이 AddFrame()을 통해 등록되어 있어야 함
-         * @post 지정된 경로에 WebP 애니메이션 파일이 생성됨
          */
-        Error SaveToFile(_In_ const std::wstring& fileName) const;
+        [[nodiscard]] Error Assemble(_Out_ std::vector<uint8_t>& outData) override;
+
+        /**
+         * @brief ePixelFormat::Indexed8을 반환 (WebPAnimEncoder는 프레임 비교를 ARGB로 하므로 AddFrame()에서 ARGB로 펼침)
+         */
+        [[nodiscard]] ePixelFormat GetPixelFormat() const noexcept override { return ePixelFormat::Indexed8; }
+
+        /**
+         * @brief L".webp"를 반환
+         */
+        [[nodiscard]] const wchar_t* GetFileExtension() const noexcept override { return L".webp"; }
 
     private:
-        const size_t mFrameDelayMs = 80; // 프레임 간 딜레이 (단위: ms)
         size_t mEncodedFrame = 0; // 현재까지 인코딩된 프레임 수
+        int mTimestampMs = 0; // 다음 프레임의 시작 시각 (건너뛴 중복 프레임의 시간 포함)
+        std::vector<uint32_t> mRowPixels; // 직전 프레임과 비교하기 위해 한 줄을 펼쳐 두는 버퍼
         WebPAnimEncoder* mEncoder = nullptr; // libwebp 애니메이션 인코더 핸들
         WebPConfig mConfig{}; // WebP 인코딩 설정 정보
-        WebPPicture mPicture{}; // 현재 프레임 데이터를 담는 구조체
+        WebPPicture mPicture{}; // 현재 프레임의 ARGB 픽셀 (프레임 사이에 유지하고 바뀐 영역만 다시 펼침)
     };
 }
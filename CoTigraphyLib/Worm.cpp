@@ -1,5 +1,5 @@
 ﻿// \file Worm.cpp
-// \last_updated 2025-06-14
+// \last_updated 2026-10-16
 // \author Oh Sungsik <ohsungsik@outlook.com>
 // \copyright (C) 2025. Oh Sungsik. All rights reserved.
 
@@ -35,7 +35,14 @@ namespace CoTigraphy
 
         if (mPlannedPath.empty())
         {
-            if (!FindPathToClosestTarget(contributionCount, mPlannedPath))
+            // 남은 목표가 없으면 BFS 생략
+            if (!mGrid.HasContributionAtOrBelow(contributionCount))
+                return false;
+
+            const bool found = (mRouteStrategy == eRouteStrategy::Optimized)
+                                   ? FindPathToNextRouteTarget(contributionCount, mPlannedPath)
+                                   : FindPathToClosestTarget(contributionCount, mPlannedPath);
+            if (!found)
             {
                 // 이동 가능한 Target 없음 → 아무것도 하지 않음
                 return false;
@@ -47,6 +54,35 @@ namespace CoTigraphy
         const POINT next = mPlannedPath.front();
         mPlannedPath.erase(mPlannedPath.begin());
 
+        const size_t week = static_cast<size_t>(next.x);
+        const size_t day = static_cast<size_t>(next.y);
+
+        SimulationEvent simulationEvent;
+        simulationEvent.mWeek = static_cast<uint16_t>(week);
+        simulationEvent.mDay = static_cast<uint8_t>(day);
+        simulationEvent.mColor = RGB(255, 255, 255);
+        if (mGrid.GetContributionCount(week, day) != 0)
+            simulationEvent.mFlags |= static_cast<uint8_t>(eSimulationEventFlag::AteContribution);
+
+        Apply(simulationEvent);
+
+        return true;
+    }
+
+    void Worm::Apply(_In_ const SimulationEvent& simulationEvent)
+    {
+        const size_t week = simulationEvent.mWeek;
+        const size_t day = simulationEvent.mDay;
+        PRECONDITION(mGrid.IsInside(week, day));
+
+        const POINT next = {static_cast<LONG>(week), static_cast<LONG>(day)};
+
+        // 이동 전 구간 위치와 새 머리 위치가 이번 프레임에서 바뀌는 셀
+        mDirtyCells.clear();
+        for (const WormSegment& segment : mWormSegments)
+            mDirtyCells.push_back(segment.mPoint);
+        mDirtyCells.push_back(next);
+
         // > Head 는 0번째, 나머지 뒤로 이동
         std::copy_backward(
             mWormSegments.begin(), // 시작 위치
@@ -55,10 +91,10 @@ namespace CoTigraphy
         );
 
         mWormSegments[0].mPoint = next;
-        mGrid.SetContributionCount(static_cast<size_t>(next.x), static_cast<size_t>(next.y), 0);
-        mGrid.SetColor(static_cast<size_t>(next.x), static_cast<size_t>(next.y), RGB(255, 255, 255));
+        mGrid.SetContributionCount(week, day, 0);
+        mGrid.SetColor(week, day, simulationEvent.mColor);
 
-        return true;
+        mLastEvent = simulationEvent;
     }
 
     bool Worm::FindPathToClosestTarget(_In_ const uint64_t& currentContributionCount,
@@ -69,14 +105,15 @@ namespace CoTigraphy
         // BFS 시작 위치는 지렁이 머리 (맨 앞 세그먼트)
         const POINT start = mWormSegments[0].mPoint;
 
+        // 방문 여부와 부모 위치는 Grid와 같은 연속 배열 인덱스로 저장
+        const size_t cellCount = mGrid.GetWeekCount() * mGrid.GetDayCount();
         std::queue<POINT> bfsQueue; // BFS 탐색 큐
-        std::set<std::pair<int, int>> visited; // 방문한 위치를 저장 (중복 방문 방지)
-        std::map<std::pair<int, int>, POINT> parentMap; // 역추적을 위한 부모 정보 저장 (자식 위치 -> 부모 위치)
+        std::vector<uint8_t> visited(cellCount, 0); // 방문한 위치 (중복 방문 방지)
+        std::vector<POINT> parents(cellCount); // 역추적을 위한 부모 위치 (자식 인덱스 -> 부모 위치)
 
         // 시작 지점 등록
         bfsQueue.push(start);
-        visited.insert({start.x, start.y});
-
+        visited[mGrid.GetCellIndex(static_cast<size_t>(start.x), static_cast<size_t>(start.y))] = 1;
 
         // BFS 탐색 시작
         while (!bfsQueue.empty())
@@ -88,21 +125,81 @@ namespace CoTigraphy
             if (IsTargetCell(current, currentContributionCount, start))
             {
                 // 역추적 경로 생성
-                BuildPath(current, parentMap, outPath);
+                BuildPath(current, start, parents, outPath);
                 return true;
             }
 
             // 다음 탐색 가능한 이웃 노드를 큐에 추가
-            EnqueueNeighbors(current, bfsQueue, visited, parentMap);
+            EnqueueNeighbors(current, bfsQueue, visited, parents);
         }
 
         // 더 이상 유효한 목표가 없음
         return false;
     }
 
-    std::pair<int, int> Worm::MakeKey(_In_ const POINT& pt) const noexcept
+    bool Worm::FindPathToNextRouteTarget(_In_ const uint64_t& currentContributionCount,
+                                         _Out_ std::vector<POINT>& outPath)
     {
-        return {pt.x, pt.y};
+        outPath.clear();
+
+        const POINT head = mWormSegments[0].mPoint;
+
+        if (mRouteLevel != currentContributionCount)
+        {
+            mRouteTargets.clear();
+            mNextRouteTarget = 0;
+            mRouteLevel = currentContributionCount;
+        }
+
+        for (bool replanned = false; ; replanned = true)
+        {
+            // 다른 목표로 가는 길에 이미 먹힌 셀은 건너뜀
+            while (mNextRouteTarget < mRouteTargets.size() &&
+                !IsTargetCell(mRouteTargets[mNextRouteTarget], currentContributionCount, head))
+            {
+                mNextRouteTarget++;
+            }
+
+            if (mNextRouteTarget < mRouteTargets.size())
+                break;
+
+            if (replanned)
+                return false;
+
+            // 계획을 모두 소진했으면 남은 목표 셀을 모아 다시 계획
+            mRouteTargets.clear();
+            mNextRouteTarget = 0;
+            for (size_t week = 0; week < mGrid.GetWeekCount(); ++week)
+            {
+                for (size_t day = 0; day < mGrid.GetDayCount(); ++day)
+                {
+                    const POINT pt = {static_cast<LONG>(week), static_cast<LONG>(day)};
+                    if (IsTargetCell(pt, currentContributionCount, head))
+                        mRouteTargets.push_back(pt);
+                }
+            }
+
+            if (mRouteTargets.empty())
+                return false;
+
+            mRoutePlanner.Plan(head, mRouteTargets);
+        }
+
+        const POINT target = mRouteTargets[mNextRouteTarget++];
+
+        POINT current = head;
+        while (current.x != target.x)
+        {
+            current.x += (target.x > current.x) ? 1 : -1;
+            outPath.push_back(current);
+        }
+        while (current.y != target.y)
+        {
+            current.y += (target.y > current.y) ? 1 : -1;
+            outPath.push_back(current);
+        }
+
+        return true;
     }
 
     bool Worm::IsTargetCell(_In_ const POINT& pt, _In_ const uint64_t& currentContributionCount,
@@ -115,23 +212,22 @@ namespace CoTigraphy
         return (count != 0 && count <= currentContributionCount && !(pt.x == start.x && pt.y == start.y));
     }
 
-    void Worm::BuildPath(_In_ const POINT& goal, _In_ const std::map<std::pair<int, int>, POINT>& parentMap,
+    void Worm::BuildPath(_In_ const POINT& goal, _In_ const POINT& start, _In_ const std::vector<POINT>& parents,
                          _Out_ std::vector<POINT>& outPath) const
     {
         POINT cur = goal;
         while (true)
         {
             outPath.push_back(cur);
-            const auto& it = parentMap.find(MakeKey(cur));
-            if (it == parentMap.end()) break;
-            cur = it->second;
+            if (cur.x == start.x && cur.y == start.y) break;
+            cur = parents[mGrid.GetCellIndex(static_cast<size_t>(cur.x), static_cast<size_t>(cur.y))];
         }
         std::reverse(outPath.begin(), outPath.end());
     }
 
     void Worm::EnqueueNeighbors(_In_ const POINT& current, _In_ std::queue<POINT>& bfsQueue,
-                                _Inout_ std::set<std::pair<int, int>>& visited,
-                                _Inout_ std::map<std::pair<int, int>, POINT>& parentMap) const
+                                _Inout_ std::vector<uint8_t>& visited,
+                                _Inout_ std::vector<POINT>& parents) const
     {
         // 상하좌우 방향 정의
         constexpr std::array<POINT, 4> directions = {
@@ -144,13 +240,14 @@ namespace CoTigraphy
         for (const POINT& d : directions)
         {
             const POINT next = {current.x + d.x, current.y + d.y};
-            const std::pair<int, int> key = MakeKey(next);
 
             if (!mGrid.IsInside(static_cast<size_t>(next.x), static_cast<size_t>(next.y))) continue;
-            if (visited.count(key)) continue;
 
-            visited.insert(key);
-            parentMap[key] = current;
+            const size_t index = mGrid.GetCellIndex(static_cast<size_t>(next.x), static_cast<size_t>(next.y));
+            if (visited[index]) continue;
+
+            visited[index] = 1;
+            parents[index] = current;
             bfsQueue.push(next);
         }
     }
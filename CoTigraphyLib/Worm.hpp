@@ -1,16 +1,17 @@
 ﻿// \file Worm.hpp
-// \last_updated 2025-06-14
+// \last_updated 2026-10-16
 // \author Oh Sungsik <ohsungsik@outlook.com>
 // \copyright (C) 2025. Oh Sungsik. All rights reserved.
 
 #pragma once
 
 #include <array>
-#include <map>
 #include <queue>
-#include <set>
 #include <vector>
 
+#include "RoutePlanner.hpp"
+#include "SimulationLog.hpp"
+
 namespace CoTigraphy
 {
     class Grid;
@@ -31,6 +32,7 @@ namespace CoTigraphy
      * - 내부적으로 길이 4의 지렁이 구간을 보유하며, Grid 객체를 참조하여 이동
      * - 각 이동마다 가장 가까운 목표 셀을 찾아 경로를 생성하고, 해당 경로로 한 칸씩 이동
      * - 지렁이는 아직 방문하지 않은 셀(currentLevel 이하)에 도달하기 위해 BFS 기반 경로 탐색을 수행
+     * - eRouteStrategy::Optimized이면 레벨마다 RoutePlanner로 방문 순서를 미리 계획하고 그 순서대로 이동
      */
     class Worm final
     {
@@ -55,6 +57,22 @@ namespace CoTigraphy
          */
         [[nodiscard]] std::array<WormSegment, 4> GetWorm() const noexcept { return mWormSegments; };
 
+        /**
+         * @brief 마지막 이동(Move() 성공 또는 Apply())으로 화면이 바뀌었을 수 있는 셀 목록을 반환
+         * @return 이동 전 구간 위치 + 새 머리 위치 (중복 가능)
+         * @details
+         * - 이동 전 구간 위치: 꼬리가 빠져나간 셀과 구간이 한 칸씩 밀린 셀
+         * - 새 머리 위치: 지렁이가 먹어서 색상이 바뀐 셀
+         */
+        [[nodiscard]] const std::vector<POINT>& GetDirtyCells() const noexcept { return mDirtyCells; }
+
+        /**
+         * @brief 목표 셀을 고르는 방식을 설정
+         * @param routeStrategy 목표 셀 선택 방식
+         * @pre 첫 Move() 호출 전에 설정
+         */
+        void SetRouteStrategy(_In_ const eRouteStrategy routeStrategy) noexcept { mRouteStrategy = routeStrategy; }
+
         /**
          * @brief 현재 레벨의 목표 셀을 찾아 한 칸 이동
          * @param contributionCount 현재 탐색 중인 Contributon 횟수 (즉, 1 → 2 → ... → MaxCount 순)
@@ -62,9 +80,25 @@ namespace CoTigraphy
          * @details
          * - 내부적으로 경로를 계산하여, 한 스텝씩 이동
          * - 목표 셀에 도달하면 다음 레벨로 넘어가기 위해 false 반환
+         * - 이동에 성공하면 그 결과를 GetLastEvent()로 얻을 수 있음
          */
         [[nodiscard]] bool Move(_In_ const uint64_t& contributionCount);
 
+        /**
+         * @brief 기록된 이벤트 하나를 BFS 없이 그대로 적용
+         * @param simulationEvent Move()가 만든 이벤트 (SimulationLog에서 읽은 값)
+         * @pre simulationEvent의 좌표가 Grid 내부
+         * @details
+         * - 머리를 이벤트 좌표로 옮기고 나머지 구간을 한 칸씩 밀며, 해당 셀의 Contribution 횟수와 색상을 갱신
+         * - Move()와 같은 방식으로 GetDirtyCells()를 갱신
+         */
+        void Apply(_In_ const SimulationEvent& simulationEvent);
+
+        /**
+         * @brief 마지막으로 적용된 이벤트를 반환
+         */
+        [[nodiscard]] const SimulationEvent& GetLastEvent() const noexcept { return mLastEvent; }
+
     private:
         /**
          * @brief 현재 레벨에서 도달 가능한 가장 가까운 목표 셀로의 경로를 찾음 (BFS 기반)
@@ -76,13 +110,17 @@ namespace CoTigraphy
                                                    _Out_opt_ std::vector<POINT>& outPath) const;
 
         /**
-         * @brief 좌표를 방문 기록용 key로 변환합니다.
-         *
-         * @param pt 좌표 (POINT 구조체)
-         * @return (x, y) 쌍을 pair로 반환하여 std::set/map 키로 사용 가능
+         * @brief 현재 레벨의 계획된 방문 순서에서 다음 목표 셀로의 경로를 만듦
+         * @param currentContributionCount 검색 대상인 Contributon 레벨
+         * @param outPath 머리 다음 칸부터 목표 셀까지의 경로
+         * @return 남은 목표 셀이 있으면 true
+         * @details
+         * - 레벨이 바뀌었거나 계획된 목표를 모두 먹었으면 남은 목표 셀을 모아 RoutePlanner로 다시 계획
+         * - 이동 중에 이미 먹힌 목표 셀은 건너뜀
+         * - 장애물이 없으므로 가로(주) 방향으로 먼저, 세로(요일) 방향으로 나중에 이동하는 최단 경로를 사용
          */
-        [[nodiscard]] std::pair<int, int> MakeKey(_In_ const POINT& pt) const noexcept;
-
+        [[nodiscard]] bool FindPathToNextRouteTarget(_In_ const uint64_t& currentContributionCount,
+                                                     _Out_ std::vector<POINT>& outPath);
 
         /**
          * @brief 주어진 좌표가 유효한 목표(먹이)인지 판단합니다.
@@ -105,13 +143,14 @@ namespace CoTigraphy
          * @brief BFS 탐색을 통해 찾은 목표 지점에서 시작점까지의 경로를 역추적하여 outPath에 저장합니다.
          *
          * @param goal 목표 지점 좌표
-         * @param parentMap 자식 → 부모 좌표 정보를 담은 맵
+         * @param start 시작 지점 좌표
+         * @param parents 셀 인덱스(Grid::GetCellIndex()) → 부모 좌표 배열
          * @param outPath 경로 저장 대상 벡터 (결과로서 반환됨)
          *
-         * @details goal부터 시작점까지 parentMap을 따라 거슬러 올라가며 경로를 구성하고,
+         * @details goal부터 시작점까지 parents를 따라 거슬러 올라가며 경로를 구성하고,
          * 이후 reverse()를 통해 경로를 올바른 순서(시작 -> 목표)로 재배열합니다.
          */
-        void BuildPath(_In_ const POINT& goal, _In_ const std::map<std::pair<int, int>, POINT>& parentMap,
+        void BuildPath(_In_ const POINT& goal, _In_ const POINT& start, _In_ const std::vector<POINT>& parents,
                        _Out_ std::vector<POINT>& outPath) const;
 
         /**
@@ -119,22 +158,31 @@ namespace CoTigraphy
          *
          * @param current 현재 위치 좌표
          * @param bfsQueue BFS 큐
-         * @param visited 방문한 좌표 집합
-         * @param parentMap 자식 -> 부모 관계 저장용 맵
+         * @param visited 셀 인덱스별 방문 여부
+         * @param parents 셀 인덱스별 부모 좌표
          *
          * @details
          * - 현재 좌표를 기준으로 4방향 탐색
          * - 그리드 내부이고 아직 방문하지 않은 좌표만 BFS 큐에 추가
-         * - 동시에 parentMap에 현재 좌표를 부모로 기록하여 경로 복원에 활용
+         * - 동시에 parents에 현재 좌표를 부모로 기록하여 경로 복원에 활용
+         * - visited/parents는 Grid와 같은 연속 배열 인덱스를 사용하므로 트리 탐색 없이 접근
          */
         void EnqueueNeighbors(_In_ const POINT& current, _In_ std::queue<POINT>& bfsQueue,
-                              _Inout_ std::set<std::pair<int, int>>& visited,
-                              _Inout_ std::map<std::pair<int, int>, POINT>& parentMap) const;
+                              _Inout_ std::vector<uint8_t>& visited,
+                              _Inout_ std::vector<POINT>& parents) const;
 
     private:
         Grid& mGrid;
 
         std::array<WormSegment, 4> mWormSegments;
         std::vector<POINT> mPlannedPath;
+
+        eRouteStrategy mRouteStrategy = eRouteStrategy::Greedy; // 목표 셀 선택 방식
+        RoutePlanner mRoutePlanner;
+        std::vector<POINT> mRouteTargets; // 현재 레벨의 계획된 방문 순서
+        size_t mNextRouteTarget = 0; // mRouteTargets에서 다음에 방문할 인덱스
+        uint64_t mRouteLevel = 0; // mRouteTargets를 계획한 레벨
+        std::vector<POINT> mDirtyCells; // 마지막 이동으로 다시 그려야 하는 셀
+        SimulationEvent mLastEvent; // 마지막으로 적용된 이벤트
     };
 } // CoTigraphy
@@ -0,0 +1,57 @@
+﻿// \file test_batch_renderer.cpp
+// \last_updated 2026-10-16
+// \author Oh Sungsik <ohsungsik@outlook.com>
+// \copyright (C) 2025. Oh Sungsik. All rights reserved.
+
+#include "pch.hpp"
+#include <BatchRenderer.hpp>
+
+namespace CoTigraphy
+{
+	// 정상 목록 파싱
+	TEST(UnitTest_BatchRenderer, ParseJobs_Success)
+	{
+		std::vector<RenderJob> jobs;
+		const Error error = BatchRenderer::ParseJobs(L"octocat out/octocat.webp\nohsungsik\tout/ohsungsik.webp\n", jobs);
+
+		EXPECT_TRUE(error.IsSucceeded());
+		ASSERT_EQ(jobs.size(), 2u);
+		EXPECT_EQ(jobs[0].mUserName, L"octocat");
+		EXPECT_EQ(jobs[0].mOutputPath, L"out/octocat.webp");
+		EXPECT_EQ(jobs[1].mUserName, L"ohsungsik");
+		EXPECT_EQ(jobs[1].mOutputPath, L"out/ohsungsik.webp");
+	}
+
+	// 빈 줄, 주석, CRLF, BOM, 공백이 포함된 출력 경로
+	TEST(UnitTest_BatchRenderer, ParseJobs_IgnoresCommentsAndBlankLines)
+	{
+		std::vector<RenderJob> jobs;
+		const Error error = BatchRenderer::ParseJobs(
+			L"\xFEFF# user output\r\n\r\n   \r\n  octocat   C:\\My Banners\\octocat.webp  \r\n", jobs);
+
+		EXPECT_TRUE(error.IsSucceeded());
+		ASSERT_EQ(jobs.size(), 1u);
+		EXPECT_EQ(jobs[0].mUserName, L"octocat");
+		EXPECT_EQ(jobs[0].mOutputPath, L"C:\\My Banners\\octocat.webp");
+	}
+
+	// 출력 경로 누락
+	TEST(UnitTest_BatchRenderer, ParseJobs_FailsWhenOutputMissing)
+	{
+		std::vector<RenderJob> jobs;
+		const Error error = BatchRenderer::ParseJobs(L"octocat out/octocat.webp\nohsungsik\n", jobs);
+
+		EXPECT_TRUE(error.IsFailed());
+		EXPECT_EQ(error, eErrorCode::InvalidUsersFile);
+	}
+
+	// 빈 목록은 파싱 자체는 성공
+	TEST(UnitTest_BatchRenderer, ParseJobs_EmptyText)
+	{
+		std::vector<RenderJob> jobs{ RenderJob{ L"stale", L"stale.webp" } };
+		const Error error = BatchRenderer::ParseJobs(L"", jobs);
+
+		EXPECT_TRUE(error.IsSucceeded());
+		EXPECT_TRUE(jobs.empty());
+	}
+}	// namespace CoTigraphy
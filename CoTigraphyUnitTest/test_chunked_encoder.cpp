@@ -0,0 +1,74 @@
+﻿// \file test_chunked_encoder.cpp
+// \last_updated 2026-10-16
+// \author Oh Sungsik <ohsungsik@outlook.com>
+// \copyright (C) 2025. Oh Sungsik. All rights reserved.
+
+#include "pch.hpp"
+#include <ChunkedEncoder.hpp>
+#include <Renderer.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
+#include "test_grid_data.hpp"
+
+namespace CoTigraphy
+{
+	class UnitTest_ChunkedEncoder : public ::testing::Test
+	{
+	protected:
+		static GridData MakeGridData()
+		{
+			return MakePatternGridData(20);
+		}
+
+		static GridCanvasContext MakeContext(_In_ const GridData& gridData)
+		{
+			return Renderer::MakeCanvasContext(gridData.mWeekCount, CellLayout{}, 1);
+		}
+
+		static std::vector<char> EncodeToBytes(_In_ const SimulationLog& simulationLog,
+		                                       _In_ const eFrameWriterType frameWriterType,
+		                                       _In_ const eTimeline timeline, _In_ const size_t threadCount)
+		{
+			const std::filesystem::path path = std::filesystem::temp_directory_path() / L"CoTigraphy_chunked.webp";
+
+			ChunkedEncoder chunkedEncoder;
+			chunkedEncoder.Initialize(frameWriterType, EncodeOptions{}, threadCount);
+			EXPECT_TRUE(chunkedEncoder.Encode(simulationLog, MakeContext(simulationLog.GetGridData()), timeline).IsSucceeded());
+			EXPECT_TRUE(chunkedEncoder.SaveToFile(path.wstring()).IsSucceeded());
+
+			std::ifstream file(path, std::ios::binary);
+			std::vector<char> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+			file.close();
+			std::filesystem::remove(path);
+			return bytes;
+		}
+	};
+
+	// chunk 경계는 스레드 수(1 이상)와 무관하므로 출력이 바이트 단위로 같아야 함
+	// (--encode_threads 0은 단일 파이프라인으로 파일은 다르고, 프레임/시간은 UnitTest_RenderSimulationLog에서 비교)
+	TEST_F(UnitTest_ChunkedEncoder, Encode_SameOutputForAnyThreadCount)
+	{
+		SimulationLog simulationLog;
+		Renderer::Simulate(MakeGridData(), eRouteStrategy::Greedy, simulationLog);
+		ASSERT_GT(simulationLog.GetEvents().size(), 64u);
+
+		for (const eFrameWriterType frameWriterType : {eFrameWriterType::AnimEncoder, eFrameWriterType::SubRectMux})
+		{
+			for (const eTimeline timeline : {eTimeline::Uniform, eTimeline::Dynamic})
+			{
+				const std::vector<char> singleThread = EncodeToBytes(simulationLog, frameWriterType, timeline, 1);
+				ASSERT_FALSE(singleThread.empty());
+
+				// chunk 수보다 많은 스레드 수도 포함
+				for (const size_t threadCount : {size_t{2}, size_t{3}, size_t{16}})
+				{
+					SCOPED_TRACE(threadCount);
+					EXPECT_EQ(singleThread, EncodeToBytes(simulationLog, frameWriterType, timeline, threadCount));
+				}
+			}
+		}
+	}
+}	// namespace CoTigraphy
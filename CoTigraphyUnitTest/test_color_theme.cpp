@@ -0,0 +1,38 @@
+﻿// \file test_color_theme.cpp
+// \last_updated 2026-10-16
+// \author Oh Sungsik <ohsungsik@outlook.com>
+// \copyright (C) 2025. Oh Sungsik. All rights reserved.
+
+#include "pch.hpp"
+#include <ColorTheme.hpp>
+
+namespace CoTigraphy
+{
+	// 목록 순서대로 기본 제공 테마를 찾음
+	TEST(UnitTest_ColorTheme, ParseList_Success)
+	{
+		std::vector<ColorTheme> colorThemes;
+		const Error error = ColorTheme::ParseList(L"dark,light", colorThemes);
+
+		EXPECT_TRUE(error.IsSucceeded());
+		ASSERT_EQ(colorThemes.size(), 2u);
+		EXPECT_EQ(colorThemes[0].mName, L"dark");
+		EXPECT_EQ(colorThemes[0].mBackgroundColor, RGB(0x0D, 0x11, 0x17));
+		EXPECT_FALSE(colorThemes[0].mColorTable.empty());
+		EXPECT_EQ(colorThemes[1].mName, L"light");
+		EXPECT_EQ(colorThemes[1].mBackgroundColor, RGB(0xFF, 0xFF, 0xFF));
+	}
+
+	// 모르는 이름, 빈 이름, 중복된 이름
+	TEST(UnitTest_ColorTheme, ParseList_FailsOnInvalidNames)
+	{
+		for (const wchar_t* const names : {L"dark,sepia", L"", L"dark,", L"dark,dark"})
+		{
+			std::vector<ColorTheme> colorThemes;
+			const Error error = ColorTheme::ParseList(names, colorThemes);
+
+			EXPECT_EQ(error, eErrorCode::InvalidArguments) << names;
+			EXPECT_TRUE(colorThemes.empty()) << names;
+		}
+	}
+}	// namespace CoTigraphy
@@ -0,0 +1,68 @@
+﻿// \file test_encode_options.cpp
+// \last_updated 2026-10-16
+// \author Oh Sungsik <ohsungsik@outlook.com>
+// \copyright (C) 2025. Oh Sungsik. All rights reserved.
+
+#include "pch.hpp"
+#include <EncodeOptions.hpp>
+
+namespace CoTigraphy
+{
+	// balanced는 이전 출력과 같도록 기본값을 유지
+	TEST(UnitTest_EncodeOptions, ParsePreset_Success)
+	{
+		eEncodePreset encodePreset = eEncodePreset::Balanced;
+		EXPECT_TRUE(EncodeOptions::ParsePreset(L"smallest", encodePreset).IsSucceeded());
+		EXPECT_EQ(encodePreset, eEncodePreset::Smallest);
+
+		const EncodeOptions balanced = EncodeOptions::FromPreset(eEncodePreset::Balanced);
+		EXPECT_EQ(balanced.mQuality, 90.0f);
+		EXPECT_EQ(balanced.mMethod, 4);
+		EXPECT_FALSE(balanced.mMinimizeSize);
+
+		EXPECT_EQ(EncodeOptions::ParsePreset(L"fastest", encodePreset), eErrorCode::InvalidArguments);
+	}
+
+	// 프리셋 위에 지정한 항목만 덮어씀
+	TEST(UnitTest_EncodeOptions, ParseOverrides_Success)
+	{
+		EncodeOptions encodeOptions = EncodeOptions::FromPreset(eEncodePreset::Fast);
+		const Error error = EncodeOptions::ParseOverrides(L"quality=75,kmin=3,kmax=10", false, encodeOptions);
+
+		EXPECT_TRUE(error.IsSucceeded());
+		EXPECT_EQ(encodeOptions.mQuality, 75.0f);
+		EXPECT_EQ(encodeOptions.mKeyframeMin, 3);
+		EXPECT_EQ(encodeOptions.mKeyframeMax, 10);
+		EXPECT_EQ(encodeOptions.mMethod, 0);
+		EXPECT_EQ(encodeOptions.mThreadLevel, 1);
+	}
+
+	// 모르는 key, 범위를 벗어난 값, 형식 오류가 있으면 설정을 바꾸지 않음
+	TEST(UnitTest_EncodeOptions, ParseOverrides_FailsOnInvalidItems)
+	{
+		for (const wchar_t* const overrides : {L"speed=1", L"method=7", L"quality=-1", L"method", L"", L"method=6,"})
+		{
+			EncodeOptions encodeOptions;
+			const Error error = EncodeOptions::ParseOverrides(overrides, false, encodeOptions);
+
+			EXPECT_EQ(error, eErrorCode::InvalidArguments) << overrides;
+			EXPECT_EQ(encodeOptions.mMethod, 4) << overrides;
+		}
+	}
+
+	// 팔레트 무손실 인코딩에서 무시되는 quality/lossless/near_lossless는 palette=0 없이 지정할 수 없음
+	TEST(UnitTest_EncodeOptions, ParseOverrides_RejectsLossyKeysOnPaletteCanvas)
+	{
+		for (const wchar_t* const overrides : {L"quality=75", L"lossless=1", L"method=6,near_lossless=60"})
+		{
+			EncodeOptions encodeOptions;
+			EXPECT_EQ(EncodeOptions::ParseOverrides(overrides, true, encodeOptions), eErrorCode::InvalidArguments) << overrides;
+			EXPECT_EQ(encodeOptions.mMethod, 4) << overrides;
+		}
+
+		EncodeOptions encodeOptions;
+		EXPECT_TRUE(EncodeOptions::ParseOverrides(L"quality=75,palette=0", true, encodeOptions).IsSucceeded());
+		EXPECT_EQ(encodeOptions.mQuality, 75.0f);
+		EXPECT_FALSE(encodeOptions.mPaletteLossless);
+	}
+}	// namespace CoTigraphy
@@ -0,0 +1,114 @@
+﻿// \file test_frame_pipeline.cpp
+// \last_updated 2026-10-16
+// \author Oh Sungsik <ohsungsik@outlook.com>
+// \copyright (C) 2025. Oh Sungsik. All rights reserved.
+
+#include "pch.hpp"
+#include <FramePipeline.hpp>
+
+#include <set>
+#include <thread>
+
+namespace CoTigraphy
+{
+	// 버퍼 수보다 많은 프레임을 보내도 순서대로 모두 전달되어야 함
+	TEST(UnitTest_FramePipeline, PushPop_PreservesOrderWithRecycledBuffers)
+	{
+		constexpr size_t frameCount = 100;
+
+		FramePipeline pipeline;
+		pipeline.Create(sizeof(size_t), 2);
+
+		std::thread producer([&pipeline]
+		{
+			for (size_t i = 0; i < frameCount; ++i)
+			{
+				const PipelineFrame frame = pipeline.AcquireFreeFrame();
+				memcpy(frame.mBuffer, &i, sizeof(i));
+				pipeline.PushFrame(frame);
+			}
+			pipeline.Close();
+		});
+
+		std::set<uint8_t*> buffers;
+		size_t received = 0;
+		PipelineFrame frame;
+		while (pipeline.PopFrame(frame))
+		{
+			size_t value = 0;
+			memcpy(&value, frame.mBuffer, sizeof(value));
+			EXPECT_EQ(value, received);
+
+			buffers.insert(frame.mBuffer);
+			pipeline.ReleaseFrame(frame);
+			received++;
+		}
+
+		producer.join();
+
+		EXPECT_EQ(received, frameCount);
+		EXPECT_LE(buffers.size(), 2u);
+	}
+
+	// Close 이후 다시 Create하면 재사용 가능해야 함
+	TEST(UnitTest_FramePipeline, Create_ResetsAfterClose)
+	{
+		FramePipeline pipeline;
+		pipeline.Create(16, 1);
+		pipeline.Close();
+
+		PipelineFrame frame;
+		EXPECT_FALSE(pipeline.PopFrame(frame));
+
+		pipeline.Create(8, 1);
+		frame = pipeline.AcquireFreeFrame();
+		pipeline.PushFrame(frame);
+		pipeline.Close();
+
+		EXPECT_TRUE(pipeline.PopFrame(frame));
+		EXPECT_FALSE(pipeline.PopFrame(frame));
+	}
+
+	// 버퍼마다 마지막으로 채운 뒤 다른 프레임들이 바꾼 영역을 알려줘야 함 (처음 쓰는 버퍼와 다시 Create한 버퍼는 전체)
+	TEST(UnitTest_FramePipeline, AcquireFreeFrame_ReturnsRegionChangedSinceBufferWasFilled)
+	{
+		FramePipeline pipeline;
+		pipeline.Create(16, 2);
+
+		PipelineFrame first = pipeline.AcquireFreeFrame();
+		EXPECT_TRUE(EqualRect(&first.mStaleRect, &FramePipeline::mWholeRect));
+		first.mDirtyRect = RECT{0, 0, 4, 4};
+		pipeline.PushFrame(first);
+
+		PipelineFrame second = pipeline.AcquireFreeFrame();
+		EXPECT_TRUE(EqualRect(&second.mStaleRect, &FramePipeline::mWholeRect));
+		second.mDirtyRect = RECT{2, 2, 6, 6};
+		pipeline.PushFrame(second);
+
+		PipelineFrame frame;
+		for (int i = 0; i < 2; ++i)
+		{
+			ASSERT_TRUE(pipeline.PopFrame(frame));
+			pipeline.ReleaseFrame(frame);
+		}
+
+		// 첫 버퍼는 두 번째 프레임의 변경 영역만큼 뒤처짐
+		frame = pipeline.AcquireFreeFrame();
+		ASSERT_EQ(frame.mBuffer, first.mBuffer);
+		const RECT expectedFirst{2, 2, 6, 6};
+		EXPECT_TRUE(EqualRect(&frame.mStaleRect, &expectedFirst));
+		frame.mDirtyRect = RECT{8, 8, 10, 10};
+		pipeline.PushFrame(frame);
+
+		// 두 번째 버퍼는 채운 뒤 들어간 세 번째 프레임의 변경 영역만큼 뒤처짐
+		frame = pipeline.AcquireFreeFrame();
+		ASSERT_EQ(frame.mBuffer, second.mBuffer);
+		const RECT expectedSecond{8, 8, 10, 10};
+		EXPECT_TRUE(EqualRect(&frame.mStaleRect, &expectedSecond));
+		pipeline.Close();
+
+		pipeline.Create(16, 2);
+		frame = pipeline.AcquireFreeFrame();
+		EXPECT_TRUE(EqualRect(&frame.mStaleRect, &FramePipeline::mWholeRect));
+	}
+}	// namespace CoTigraphy
@@ -0,0 +1,54 @@
+﻿// \file test_frame_timeline.cpp
+// \last_updated 2026-10-16
+// \author Oh Sungsik <ohsungsik@outlook.com>
+// \copyright (C) 2025. Oh Sungsik. All rights reserved.
+
+#include "pch.hpp"
+#include <FrameTimeline.hpp>
+
+#include <numeric>
+
+namespace CoTigraphy
+{
+	namespace
+	{
+		// 먹은 이벤트(true)와 빈 셀 이동(false) 순서로 이벤트 목록을 만듦
+		std::vector<SimulationEvent> MakeEvents(_In_ const std::vector<bool>& eatings)
+		{
+			std::vector<SimulationEvent> events(eatings.size());
+			for (size_t eventIndex = 0; eventIndex < eatings.size(); ++eventIndex)
+			{
+				if (eatings[eventIndex])
+					events[eventIndex].mFlags = static_cast<uint8_t>(eSimulationEventFlag::AteContribution);
+			}
+			return events;
+		}
+	}
+
+	// Uniform은 이벤트마다 같은 시간의 프레임 1개
+	TEST(UnitTest_FrameTimeline, Build_Uniform)
+	{
+		std::vector<int> frameDurations;
+		FrameTimeline::Build(MakeEvents({false, true, false}), eTimeline::Uniform, frameDurations);
+
+		EXPECT_EQ(frameDurations, (std::vector<int>(3, FrameTimeline::mUniformFrameMs)));
+	}
+
+	// 빈 셀 이동은 mMinTravelFrameMs가 될 때까지 합치고, 먹을 때 멈추고, 끝에서 정지 화면 유지
+	TEST(UnitTest_FrameTimeline, Build_Dynamic)
+	{
+		const std::vector<SimulationEvent> events = MakeEvents({false, false, false, false, true, false, false});
+
+		std::vector<int> frameDurations;
+		FrameTimeline::Build(events, eTimeline::Dynamic, frameDurations);
+
+		constexpr int travelMs = FrameTimeline::mTravelStepMs;
+		constexpr int eatMs = FrameTimeline::mEatFrameMs;
+		constexpr int holdMs = FrameTimeline::mEndHoldMs;
+		EXPECT_EQ(frameDurations, (std::vector<int>{2 * travelMs, 0, 2 * travelMs, 0, eatMs, 2 * travelMs + holdMs, 0}));
+
+		// 전체 길이는 합치기 전과 같음
+		EXPECT_EQ(std::accumulate(frameDurations.begin(), frameDurations.end(), 0),
+		          6 * travelMs + eatMs + holdMs);
+	}
+}	// namespace CoTigraphy
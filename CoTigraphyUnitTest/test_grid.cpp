@@ -0,0 +1,112 @@
+﻿// \file test_grid.cpp
+// \last_updated 2026-10-16
+// \author Oh Sungsik <ohsungsik@outlook.com>
+// \copyright (C) 2025. Oh Sungsik. All rights reserved.
+
+#include "pch.hpp"
+#include <Grid.hpp>
+#include <Renderer.hpp>
+#include <Worm.hpp>
+
+#include "test_grid_data.hpp"
+
+namespace CoTigraphy
+{
+	class UnitTest_Grid : public ::testing::Test
+	{
+	protected:
+		// 서로 다른 Contribution 횟수가 드문드문 분포된 Grid (최대 400)
+		static GridData MakeSparseGridData()
+		{
+			constexpr uint64_t levels[] = {0, 0, 1, 7, 0, 40, 400, 0, 3};
+			return MakeTestGridData(12, 7, [&levels](const size_t week, const size_t day)
+			{
+				return levels[(week * 7 + day * 5) % std::size(levels)];
+			}, [](const uint64_t) { return RGB(0x30, 0x90, 0x30); });
+		}
+	};
+
+	// 색인은 SetContributionCount()에 따라 갱신되어야 함
+	TEST_F(UnitTest_Grid, LevelIndex_TracksRemainingCells)
+	{
+		GridData gridData;
+		gridData.mWeekCount = 2;
+		gridData.mDayCount = 1;
+		gridData.mCells = {{GridCell{0, 0, 3, 0}}, {GridCell{1, 0, 9, 0}}};
+		gridData.mMaxCount = 9;
+
+		Grid grid(gridData);
+		EXPECT_FALSE(grid.HasContributionAtOrBelow(2));
+		EXPECT_TRUE(grid.HasContributionAtOrBelow(3));
+		EXPECT_EQ(grid.GetNextContributionLevel(0), 3u);
+		EXPECT_EQ(grid.GetNextContributionLevel(3), 9u);
+		EXPECT_EQ(grid.GetNextContributionLevel(9), 0u);
+
+		grid.SetContributionCount(0, 0, 0);
+		EXPECT_FALSE(grid.HasContributionAtOrBelow(8));
+		EXPECT_EQ(grid.GetNextContributionLevel(0), 9u);
+
+		grid.SetContributionCount(1, 0, 0);
+		EXPECT_FALSE(grid.HasContributionAtOrBelow(std::numeric_limits<uint64_t>::max()));
+		EXPECT_EQ(grid.GetNextContributionLevel(0), 0u);
+	}
+
+	// 셀은 주 단위로 연속된 배열에 저장되고, 행/열 순회는 같은 값을 돌려줘야 함
+	TEST_F(UnitTest_Grid, FlatStorage_WeekAndDayIteration)
+	{
+		const GridData gridData = MakeSparseGridData();
+		const Grid grid(gridData);
+
+		ASSERT_EQ(grid.GetContributionCounts().size(), gridData.mWeekCount * gridData.mDayCount);
+		EXPECT_EQ(grid.GetCellIndex(3, 5), 3u * gridData.mDayCount + 5u);
+
+		size_t visitedCount = 0;
+		grid.ForEachCellInWeek(4, [&](const size_t day, const uint64_t count, const COLORREF color)
+		{
+			EXPECT_EQ(count, gridData.mCells[4][day].mCount);
+			EXPECT_EQ(color, gridData.mCells[4][day].mColor);
+			visitedCount++;
+		});
+		EXPECT_EQ(visitedCount, gridData.mDayCount);
+
+		visitedCount = 0;
+		grid.ForEachCellInDay(2, [&](const size_t week, const uint64_t count, const COLORREF)
+		{
+			EXPECT_EQ(count, grid.GetContributionCount(week, 2));
+			visitedCount++;
+		});
+		EXPECT_EQ(visitedCount, gridData.mWeekCount);
+	}
+
+	// 레벨을 건너뛰어도 1씩 올리는 방식과 같은 이벤트가 기록되어야 함
+	TEST_F(UnitTest_Grid, Simulate_MatchesLevelByLevelLoop)
+	{
+		const GridData gridData = MakeSparseGridData();
+
+		std::vector<SimulationEvent> expectedEvents;
+		{
+			Grid grid(gridData);
+			Worm worm(grid);
+			for (uint64_t level = 1; level <= gridData.mMaxCount;)
+			{
+				if (worm.Move(level))
+					expectedEvents.push_back(worm.GetLastEvent());
+				else
+					level++;
+			}
+		}
+
+		SimulationLog simulationLog;
+		Renderer::Simulate(gridData, eRouteStrategy::Greedy, simulationLog);
+
+		const std::vector<SimulationEvent>& events = simulationLog.GetEvents();
+		ASSERT_FALSE(expectedEvents.empty());
+		ASSERT_EQ(events.size(), expectedEvents.size());
+		for (size_t i = 0; i < events.size(); ++i)
+		{
+			EXPECT_EQ(events[i].mWeek, expectedEvents[i].mWeek);
+			EXPECT_EQ(events[i].mDay, expectedEvents[i].mDay);
+			EXPECT_EQ(events[i].mFlags, expectedEvents[i].mFlags);
+		}
+	}
+}	// namespace CoTigraphy
@@ -0,0 +1,479 @@
+﻿// \file test_grid_canvas.cpp
+// \last_updated 2026-10-16
+// \author Oh Sungsik <ohsungsik@outlook.com>
+// \copyright (C) 2025. Oh Sungsik. All rights reserved.
+
+#include "pch.hpp"
+#include <Grid.hpp>
+#include <GridCanvas.hpp>
+#include <Worm.hpp>
+
+#include <chrono>
+#include <cstdio>
+
+#include <webp/encode.h>
+
+#include "test_grid_data.hpp"
+
+namespace CoTigraphy
+{
+	class UnitTest_GridCanvas : public ::testing::Test
+	{
+	protected:
+		static constexpr size_t weekCount = 12;
+		static constexpr size_t dayCount = 7;
+		static constexpr size_t cellSize = 10;
+		static constexpr size_t cellMargin = 3;
+
+		static GridData MakeGridData()
+		{
+			return MakeTestGridData(weekCount, dayCount,
+			                        [](const size_t week, const size_t day) { return (week * 7 + day * 3) % 4; },
+			                        [](const uint64_t count) { return RGB(0x10 * count, 0x80, 0x40); });
+		}
+
+		static GridCanvasContext MakeContext(const size_t scale = 1)
+		{
+			GridCanvasContext context;
+			context.mWidth = (weekCount * (cellSize + cellMargin) - cellMargin) * scale;
+			context.mHeight = (dayCount * (cellSize + cellMargin) - cellMargin) * scale;
+			context.mCellSize = cellSize;
+			context.mCellMargin = cellMargin;
+			context.mScale = scale;
+			context.mPixelFormat = ePixelFormat::ARGB; // 다른 형식의 기준 그림 (팔레트 순서와 무관하게 픽셀로 비교)
+			return context;
+		}
+	};
+
+	// 변경 셀만 다시 그린 결과가 매 프레임 전체를 다시 그린 결과와 같아야 함 (둥근 모서리를 섞는 경우 포함)
+	TEST_F(UnitTest_GridCanvas, Render_IncrementalMatchesFullRedraw)
+	{
+		for (const size_t cellRadius : {size_t{0}, size_t{3}})
+		{
+			SCOPED_TRACE(cellRadius);
+
+			GridCanvasContext context = MakeContext();
+			context.mCellRadius = cellRadius;
+
+			GridCanvas incremental;
+			incremental.Create(context);
+			GridCanvas full;
+			full.Create(context);
+
+			const GridData gridData = MakeGridData();
+			Grid grid(gridData);
+			Worm worm(grid);
+
+			size_t frameCount = 0;
+			uint64_t currentLevel = 1;
+			while (currentLevel <= gridData.mMaxCount)
+			{
+				if (worm.Move(currentLevel) == false)
+				{
+					currentLevel++;
+					continue;
+				}
+
+				ASSERT_TRUE(incremental.Render(grid, worm).IsSucceeded());
+				full.Invalidate();
+				ASSERT_TRUE(full.Render(grid, worm).IsSucceeded());
+
+				ASSERT_EQ(memcmp(incremental.GetBuffer(), full.GetBuffer(), full.GetBufferSize()), 0)
+					<< "frame " << frameCount;
+
+				if (frameCount > 0)
+				{
+					// 변경 영역은 셀 5개 이하를 덮으므로 캔버스 전체보다 작아야 함
+					const RECT dirtyRect = incremental.GetDirtyRect();
+					EXPECT_LT(static_cast<size_t>(dirtyRect.right - dirtyRect.left) *
+					          static_cast<size_t>(dirtyRect.bottom - dirtyRect.top),
+					          context.mWidth * context.mHeight);
+				}
+
+				frameCount++;
+			}
+
+			EXPECT_GT(frameCount, 1u);
+		}
+	}
+
+	// Create 직후 첫 Render는 캔버스 전체가 변경 영역
+	TEST_F(UnitTest_GridCanvas, Render_FirstFrameIsFullCanvas)
+	{
+		const GridCanvasContext context = MakeContext();
+
+		GridCanvas canvas;
+		canvas.Create(context);
+
+		Grid grid(MakeGridData());
+		Worm worm(grid);
+		ASSERT_TRUE(worm.Move(1));
+
+		ASSERT_TRUE(canvas.Render(grid, worm).IsSucceeded());
+
+		const RECT dirtyRect = canvas.GetDirtyRect();
+		EXPECT_EQ(dirtyRect.left, 0);
+		EXPECT_EQ(dirtyRect.top, 0);
+		EXPECT_EQ(static_cast<size_t>(dirtyRect.right), context.mWidth);
+		EXPECT_EQ(static_cast<size_t>(dirtyRect.bottom), context.mHeight);
+	}
+
+	// YUV420 캔버스의 변경 영역은 libwebp가 같은 영역의 ARGB 픽셀을 변환한 결과와 같아야 함 (둥근 모서리를 섞는 경우 포함)
+	TEST_F(UnitTest_GridCanvas, Render_Yuv420MatchesLibwebpConversion)
+	{
+		for (const size_t cellRadius : {size_t{0}, size_t{3}})
+		{
+			GridCanvasContext argbContext = MakeContext();
+			argbContext.mCellRadius = cellRadius;
+			GridCanvasContext yuvContext = MakeContext();
+			yuvContext.mPixelFormat = ePixelFormat::YUV420;
+			yuvContext.mCellRadius = cellRadius;
+
+			GridCanvas argbCanvas;
+			argbCanvas.Create(argbContext);
+			GridCanvas yuvCanvas;
+			yuvCanvas.Create(yuvContext);
+
+			const size_t width = yuvContext.mWidth;
+			const size_t height = yuvContext.mHeight;
+			const size_t chromaWidth = yuvCanvas.GetChromaWidth();
+			ASSERT_EQ(yuvCanvas.GetBufferSize(), width * height + 2 * chromaWidth * yuvCanvas.GetChromaHeight());
+
+			const GridData gridData = MakeGridData();
+			Grid grid(gridData);
+			Worm worm(grid);
+
+			size_t frameCount = 0;
+			uint64_t currentLevel = 1;
+			while (currentLevel <= gridData.mMaxCount && frameCount < 40)
+			{
+				if (worm.Move(currentLevel) == false)
+				{
+					currentLevel++;
+					continue;
+				}
+
+				ASSERT_TRUE(argbCanvas.Render(grid, worm).IsSucceeded());
+				ASSERT_TRUE(yuvCanvas.Render(grid, worm).IsSucceeded());
+
+				// WebPMuxWriter와 같이 왼쪽/위쪽을 짝수로 내린 영역을 비교
+				RECT rect = yuvCanvas.GetDirtyRect();
+				if (IsRectEmpty(&rect))
+					continue;
+				rect.left &= ~1;
+				rect.top &= ~1;
+
+				WebPPicture picture;
+				ASSERT_NE(WebPPictureInit(&picture), 0);
+				picture.width = rect.right - rect.left;
+				picture.height = rect.bottom - rect.top;
+				picture.use_argb = 1;
+				picture.argb = reinterpret_cast<uint32_t*>(const_cast<uint8_t*>(argbCanvas.GetBuffer())) +
+					static_cast<size_t>(rect.top) * width + static_cast<size_t>(rect.left);
+				picture.argb_stride = static_cast<int>(width);
+				ASSERT_NE(WebPPictureARGBToYUVA(&picture, WEBP_YUV420), 0);
+
+				const uint8_t* const luma = yuvCanvas.GetBuffer();
+				const uint8_t* const chromaU = luma + width * height;
+				const uint8_t* const chromaV = chromaU + chromaWidth * yuvCanvas.GetChromaHeight();
+				for (int y = 0; y < picture.height; ++y)
+				{
+					const size_t row = static_cast<size_t>(rect.top + y) * width + static_cast<size_t>(rect.left);
+					ASSERT_EQ(memcmp(luma + row, picture.y + y * picture.y_stride, static_cast<size_t>(picture.width)), 0)
+						<< "radius " << cellRadius << ", frame " << frameCount << " y " << y;
+				}
+				for (int y = 0; y < (picture.height + 1) / 2; ++y)
+				{
+					const size_t row = static_cast<size_t>(rect.top / 2 + y) * chromaWidth + static_cast<size_t>(rect.left / 2);
+					const size_t count = static_cast<size_t>(picture.width + 1) / 2;
+					ASSERT_EQ(memcmp(chromaU + row, picture.u + y * picture.uv_stride, count), 0)
+						<< "radius " << cellRadius << ", frame " << frameCount << " u " << y;
+					ASSERT_EQ(memcmp(chromaV + row, picture.v + y * picture.uv_stride, count), 0)
+						<< "radius " << cellRadius << ", frame " << frameCount << " v " << y;
+				}
+
+				WebPPictureFree(&picture);
+				frameCount++;
+			}
+
+			EXPECT_GT(frameCount, 1u);
+		}
+	}
+
+	// N배 출력은 논리 해상도 프레임의 픽셀마다 N×N 블록으로 확대한 것과 같아야 함 (둥근 모서리를 섞는 경우 포함)
+	TEST_F(UnitTest_GridCanvas, Render_ScaledMatchesUpscaledLogicalFrame)
+	{
+		constexpr size_t scale = 3;
+
+		GridCanvasContext logicalContext = MakeContext();
+		logicalContext.mCellRadius = 3;
+		GridCanvasContext scaledContext = MakeContext(scale);
+		scaledContext.mCellRadius = 3;
+
+		GridCanvas logicalCanvas;
+		logicalCanvas.Create(logicalContext);
+		GridCanvas scaledCanvas;
+		scaledCanvas.Create(scaledContext);
+
+		const GridData gridData = MakeGridData();
+		Grid grid(gridData);
+		Worm worm(grid);
+
+		// 첫 프레임(전체)과 이후 변경 영역만 그린 프레임을 모두 비교
+		for (size_t frame = 0; frame < 8 && worm.Move(1); ++frame)
+		{
+			ASSERT_TRUE(logicalCanvas.Render(grid, worm).IsSucceeded());
+			ASSERT_TRUE(scaledCanvas.Render(grid, worm).IsSucceeded());
+
+			const RECT logicalDirtyRect = logicalCanvas.GetDirtyRect();
+			const RECT scaledDirtyRect = scaledCanvas.GetDirtyRect();
+			EXPECT_EQ(scaledDirtyRect.left, logicalDirtyRect.left * static_cast<LONG>(scale));
+			EXPECT_EQ(scaledDirtyRect.bottom, logicalDirtyRect.bottom * static_cast<LONG>(scale));
+
+			const uint32_t* logical = reinterpret_cast<const uint32_t*>(logicalCanvas.GetBuffer());
+			const uint32_t* scaled = reinterpret_cast<const uint32_t*>(scaledCanvas.GetBuffer());
+			for (size_t y = 0; y < scaledContext.mHeight; ++y)
+			{
+				for (size_t x = 0; x < scaledContext.mWidth; ++x)
+				{
+					ASSERT_EQ(scaled[y * scaledContext.mWidth + x],
+					          logical[(y / scale) * logicalContext.mWidth + x / scale])
+						<< "frame " << frame << " (" << x << ", " << y << ")";
+				}
+			}
+		}
+	}
+
+	// Indexed8 프레임을 팔레트로 펼친 결과는 ARGB로 그린 프레임과 같아야 함 (변경 셀만 다시 그리는 경우, 가장자리를 섞는 경우 포함)
+	TEST_F(UnitTest_GridCanvas, Render_IndexedMatchesArgb)
+	{
+		for (const size_t radius : {0u, 3u})
+		{
+			SCOPED_TRACE(radius);
+
+			GridCanvasContext argbContext = MakeContext(2);
+			argbContext.mCellRadius = radius;
+			GridCanvasContext indexedContext = argbContext;
+			indexedContext.mPixelFormat = ePixelFormat::Indexed8;
+
+			GridCanvas argbCanvas;
+			argbCanvas.Create(argbContext);
+			GridCanvas indexedCanvas;
+			indexedCanvas.Create(indexedContext);
+
+			const size_t pixelCount = argbContext.mWidth * argbContext.mHeight;
+			ASSERT_EQ(indexedCanvas.GetBufferSize(),
+			          PixelKernels::GetPaletteOffset(pixelCount) + PixelKernels::mPaletteCapacity * sizeof(uint32_t));
+
+			Grid grid(MakeGridData());
+			Worm worm(grid);
+			std::vector<uint32_t> expanded(pixelCount);
+			for (size_t frame = 0; frame < 40 && worm.Move(1); ++frame)
+			{
+				ASSERT_TRUE(argbCanvas.Render(grid, worm).IsSucceeded());
+				ASSERT_TRUE(indexedCanvas.Render(grid, worm).IsSucceeded());
+
+				PixelKernels::ExpandIndexedSpan(expanded.data(), indexedCanvas.GetBuffer(), pixelCount,
+				                                indexedCanvas.GetPalette());
+				ASSERT_EQ(memcmp(expanded.data(), argbCanvas.GetBuffer(), argbCanvas.GetBufferSize()), 0)
+					<< "frame " << frame;
+			}
+		}
+	}
+
+	// 매 프레임 변경 영역의 줄만 복사한 사본은 프레임 데이터 전체와 같아야 함 (YUV420의 U, V 블록 줄, Indexed8의 팔레트 포함)
+	TEST_F(UnitTest_GridCanvas, CopyFrameRows_KeepsCopyInSync)
+	{
+		for (const ePixelFormat pixelFormat : {ePixelFormat::ARGB, ePixelFormat::YUV420, ePixelFormat::Indexed8})
+		{
+			SCOPED_TRACE(static_cast<int>(pixelFormat));
+
+			GridCanvasContext context = MakeContext();
+			context.mCellRadius = 3;
+			context.mPixelFormat = pixelFormat;
+
+			GridCanvas canvas;
+			canvas.Create(context);
+			std::vector<uint8_t> copy(canvas.GetBufferSize());
+
+			Grid grid(MakeGridData());
+			Worm worm(grid);
+			for (size_t frame = 0; frame < 40 && worm.Move(1); ++frame)
+			{
+				ASSERT_TRUE(canvas.Render(grid, worm).IsSucceeded());
+				canvas.CopyFrameRows(copy.data(), canvas.GetDirtyRect());
+				ASSERT_EQ(memcmp(copy.data(), canvas.GetBuffer(), canvas.GetBufferSize()), 0) << "frame " << frame;
+			}
+		}
+	}
+
+	// 색상 변환표(테마)로 그린 프레임은 Grid 색상을 미리 바꿔 그린 프레임과 같아야 함
+	TEST_F(UnitTest_GridCanvas, Render_ColorTableMatchesRecoloredGrid)
+	{
+		const auto getThemeColor = [](const COLORREF color)
+		{
+			return RGB(GetBValue(color), GetRValue(color), 0xC0);
+		};
+
+		GridCanvasContext themeContext = MakeContext();
+		themeContext.mCellRadius = 3;
+		GridCanvasContext recoloredContext = themeContext;
+
+		GridData gridData = MakeGridData();
+		GridData recoloredData = gridData;
+		for (std::vector<GridCell>& week : recoloredData.mCells)
+		{
+			for (GridCell& cell : week)
+			{
+				const std::pair<COLORREF, COLORREF> entry(cell.mColor, getThemeColor(cell.mColor));
+				if (std::find(themeContext.mColorTable.begin(), themeContext.mColorTable.end(), entry) ==
+					themeContext.mColorTable.end())
+					themeContext.mColorTable.push_back(entry);
+				cell.mColor = entry.second;
+			}
+		}
+
+		GridCanvas themeCanvas;
+		themeCanvas.Create(themeContext);
+		GridCanvas recoloredCanvas;
+		recoloredCanvas.Create(recoloredContext);
+
+		Grid themeGrid(gridData);
+		Worm themeWorm(themeGrid);
+		Grid recoloredGrid(recoloredData);
+		Worm recoloredWorm(recoloredGrid);
+		for (size_t frame = 0; frame < 20 && themeWorm.Move(1); ++frame)
+		{
+			ASSERT_TRUE(recoloredWorm.Move(1));
+			ASSERT_TRUE(themeCanvas.Render(themeGrid, themeWorm).IsSucceeded());
+			ASSERT_TRUE(recoloredCanvas.Render(recoloredGrid, recoloredWorm).IsSucceeded());
+
+			ASSERT_EQ(memcmp(themeCanvas.GetBuffer(), recoloredCanvas.GetBuffer(), recoloredCanvas.GetBufferSize()), 0)
+				<< "frame " << frame;
+		}
+	}
+
+	// Indexed8 팔레트에 256색을 넘는 색상이 필요하면 가까운 색상으로 대신하지 않고 실패해야 함
+	TEST_F(UnitTest_GridCanvas, Render_IndexedPaletteOverflowFails)
+	{
+		GridCanvasContext context = MakeContext();
+		context.mPixelFormat = ePixelFormat::Indexed8;
+		context.mCellRadius = 3; // 셀 색상마다 섞은 가장자리 색상이 더해짐
+
+		GridData gridData = MakeGridData();
+		for (size_t week = 0; week < gridData.mCells.size(); ++week)
+		{
+			for (size_t day = 0; day < gridData.mCells[week].size(); ++day)
+				gridData.mCells[week][day].mColor = RGB(week * 0x10, day * 0x20, 0x80);
+		}
+
+		GridCanvas canvas;
+		canvas.Create(context);
+
+		Grid grid(gridData);
+		Worm worm(grid);
+		ASSERT_TRUE(worm.Move(1));
+
+		EXPECT_EQ(canvas.Render(grid, worm), eErrorCode::PaletteOverflow);
+	}
+
+	// GitHub 단계 색상으로 큰 원형 셀(60 / 30)을 끝까지 그려도 가장자리 색상이 Indexed8 팔레트에 들어가야 함
+	TEST_F(UnitTest_GridCanvas, Render_IndexedGitHubLevelsFitPalette)
+	{
+		constexpr COLORREF levelColors[] = {
+			RGB(0xEB, 0xED, 0xF0), RGB(0x9B, 0xE9, 0xA8), RGB(0x40, 0xC4, 0x63), RGB(0x30, 0xA1, 0x4E),
+			RGB(0x21, 0x6E, 0x39)
+		};
+		constexpr size_t largeCellSize = 60;
+
+		GridCanvasContext context;
+		context.mWidth = weekCount * (largeCellSize + cellMargin) - cellMargin;
+		context.mHeight = dayCount * (largeCellSize + cellMargin) - cellMargin;
+		context.mCellSize = largeCellSize;
+		context.mCellMargin = cellMargin;
+		context.mCellRadius = largeCellSize / 2;
+		context.mPixelFormat = ePixelFormat::Indexed8;
+
+		GridCanvas canvas;
+		canvas.Create(context);
+
+		Grid grid(MakeTestGridData(weekCount, dayCount,
+		                           [](const size_t week, const size_t day) { return (week * 7 + day * 3) % 5; },
+		                           [&levelColors](const uint64_t count) { return levelColors[count]; }));
+		Worm worm(grid);
+		ASSERT_TRUE(canvas.Render(grid, worm).IsSucceeded());
+
+		// Renderer::Simulate()와 같은 순서로 모든 셀을 먹을 때까지 (먹은 셀의 흰색 포함)
+		uint64_t level = grid.GetNextContributionLevel(0);
+		size_t frameCount = 0;
+		while (level != 0)
+		{
+			if (worm.Move(level) == false)
+			{
+				level = grid.GetNextContributionLevel(level);
+				continue;
+			}
+
+			ASSERT_TRUE(canvas.Render(grid, worm).IsSucceeded()) << "frame " << frameCount;
+			++frameCount;
+		}
+		EXPECT_GT(frameCount, weekCount * dayCount / 2);
+	}
+
+	// 출력 배율 N에 따른 프레임 비용 (전체 다시 그리기, 변경 영역만 그리기)
+	// 실행: --gtest_also_run_disabled_tests --gtest_filter=*Benchmark*
+	TEST_F(UnitTest_GridCanvas, DISABLED_Benchmark_RenderScale)
+	{
+		for (const ePixelFormat pixelFormat : {ePixelFormat::ARGB, ePixelFormat::Indexed8, ePixelFormat::YUV420})
+		{
+			for (const size_t scale : {1u, 2u, 3u, 4u})
+			{
+				GridCanvasContext context = MakeContext(scale);
+				context.mPixelFormat = pixelFormat;
+
+				GridCanvas canvas;
+				canvas.Create(context);
+
+				const GridData gridData = MakeGridData();
+				Grid grid(gridData);
+				Worm worm(grid);
+				ASSERT_TRUE(canvas.Render(grid, worm).IsSucceeded()); // 타일/레이어 준비
+
+				constexpr int repeatCount = 200;
+
+				auto begin = std::chrono::steady_clock::now();
+				for (int repeat = 0; repeat < repeatCount; ++repeat)
+				{
+					canvas.Invalidate();
+					ASSERT_TRUE(canvas.Render(grid, worm).IsSucceeded());
+				}
+				const double fullMicroseconds = std::chrono::duration<double, std::micro>(
+					std::chrono::steady_clock::now() - begin).count() / repeatCount;
+
+				size_t frameCount = 0;
+				begin = std::chrono::steady_clock::now();
+				for (uint64_t currentLevel = 1; currentLevel <= gridData.mMaxCount;)
+				{
+					if (worm.Move(currentLevel) == false)
+					{
+						currentLevel++;
+						continue;
+					}
+
+					ASSERT_TRUE(canvas.Render(grid, worm).IsSucceeded());
+					frameCount++;
+				}
+				const double dirtyMicroseconds = std::chrono::duration<double, std::micro>(
+					std::chrono::steady_clock::now() - begin).count() / static_cast<double>(std::max<size_t>(1, frameCount));
+
+				const char* const formatName = pixelFormat == ePixelFormat::ARGB
+					                               ? "ARGB    "
+					                               : pixelFormat == ePixelFormat::Indexed8
+					                               ? "Indexed8"
+					                               : "YUV420  ";
+				std::printf("[ BENCH    ] %s %zux (%zux%zu): full %.1f us/frame, dirty %.2f us/frame\n", formatName,
+				            scale, context.mWidth, context.mHeight, fullMicroseconds, dirtyMicroseconds);
+			}
+		}
+	}
+}	// namespace CoTigraphy
@@ -0,0 +1,53 @@
+﻿// \file test_grid_data.hpp
+// \last_updated 2026-10-16
+// \author Oh Sungsik <ohsungsik@outlook.com>
+// \copyright (C) 2025. Oh Sungsik. All rights reserved.
+
+#pragma once
+
+#include <Grid.hpp>
+
+namespace CoTigraphy
+{
+	/**
+	 * @brief 테스트용 GridData를 만듦
+	 * @param weekCount 열 수 (주 갯수)
+	 * @param dayCount 행 수 (요일 갯수)
+	 * @param getCount uint64_t(size_t week, size_t day) 형태의 셀별 Contribution 횟수
+	 * @param getColor COLORREF(uint64_t count) 형태의 Contribution 횟수별 색상
+	 * @return 모든 셀이 채워지고 mMaxCount가 계산된 GridData
+	 */
+	template <typename CountFunc, typename ColorFunc>
+	GridData MakeTestGridData(_In_ const size_t weekCount, _In_ const size_t dayCount, _In_ CountFunc&& getCount,
+	                          _In_ ColorFunc&& getColor)
+	{
+		GridData gridData;
+		gridData.mWeekCount = weekCount;
+		gridData.mDayCount = dayCount;
+		gridData.mCells.resize(weekCount);
+		for (size_t week = 0; week < weekCount; ++week)
+		{
+			for (size_t day = 0; day < dayCount; ++day)
+			{
+				GridCell cell;
+				cell.mWeek = week;
+				cell.mDay = day;
+				cell.mCount = getCount(week, day);
+				cell.mColor = getColor(cell.mCount);
+				gridData.mCells[week].push_back(cell);
+				gridData.mMaxCount = std::max(gridData.mMaxCount, cell.mCount);
+			}
+		}
+		return gridData;
+	}
+
+	/**
+	 * @brief 시뮬레이션/인코딩 테스트가 함께 쓰는 7행 GridData (레벨 0~3이 섞여 빈 셀 이동과 먹기가 모두 생김)
+	 * @param weekCount 열 수 (주 갯수)
+	 */
+	inline GridData MakePatternGridData(_In_ const size_t weekCount)
+	{
+		return MakeTestGridData(weekCount, 7, [](const size_t week, const size_t day) { return (week * 5 + day * 3) % 4; },
+		                        [](const uint64_t count) { return RGB(0x20 * count, 0x90, 0x30); });
+	}
+}	// namespace CoTigraphy
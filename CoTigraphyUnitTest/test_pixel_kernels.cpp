@@ -0,0 +1,117 @@
+﻿// \file test_pixel_kernels.cpp
+// \last_updated 2026-10-16
+// \author Oh Sungsik <ohsungsik@outlook.com>
+// \copyright (C) 2025. Oh Sungsik. All rights reserved.
+
+#include "pch.hpp"
+#include <PixelKernels.hpp>
+
+#include <chrono>
+#include <cstdio>
+
+namespace CoTigraphy
+{
+	// 정렬/길이와 관계없이 지정한 픽셀만 채워야 함
+	TEST(UnitTest_PixelKernels, FillSpan_FillsOnlySpanForAnyOffsetAndLength)
+	{
+		constexpr uint32_t guard = 0xDEADBEEF;
+		const uint32_t pixel = PixelKernels::ToPixel(RGB(0x12, 0x34, 0x56));
+
+		for (size_t offset = 0; offset < 8; ++offset)
+		{
+			for (size_t count = 0; count <= 41; ++count)
+			{
+				std::vector<uint32_t> buffer(64, guard);
+				PixelKernels::FillSpan(buffer.data() + offset, count, pixel);
+
+				for (size_t i = 0; i < buffer.size(); ++i)
+				{
+					const bool isFilled = (i >= offset && i < offset + count);
+					ASSERT_EQ(buffer[i], isFilled ? pixel : guard) << "offset=" << offset << " count=" << count;
+				}
+			}
+		}
+	}
+
+	// 첫 줄을 복사한 나머지 줄도 사각형 안쪽만 채워야 함 (줄 사이 여백은 유지)
+	TEST(UnitTest_PixelKernels, FillRect_FillsOnlyRect)
+	{
+		constexpr uint32_t guard = 0xDEADBEEF;
+		constexpr size_t width = 16;
+		constexpr size_t height = 6;
+		const uint32_t pixel = PixelKernels::ToPixel(RGB(0x12, 0x34, 0x56));
+
+		std::vector<uint32_t> buffer(width * height, guard);
+		PixelKernels::FillRect(reinterpret_cast<uint8_t*>(buffer.data() + 1 * width + 3), width * sizeof(uint32_t), 5, 4,
+		                       pixel);
+
+		for (size_t y = 0; y < height; ++y)
+		{
+			for (size_t x = 0; x < width; ++x)
+			{
+				const bool isFilled = (x >= 3 && x < 8 && y >= 1 && y < 5);
+				ASSERT_EQ(buffer[y * width + x], isFilled ? pixel : guard) << "x=" << x << " y=" << y;
+			}
+		}
+	}
+
+	// 픽셀 값은 불투명한 0xAARRGGBB여야 함 (WebPPicture::argb 형식)
+	TEST(UnitTest_PixelKernels, ToPixel_ReturnsOpaqueArgb)
+	{
+		EXPECT_EQ(PixelKernels::ToPixel(RGB(0x12, 0x34, 0x56)), 0xFF123456u);
+		EXPECT_EQ(PixelKernels::ToPixel(RGB(0x00, 0x00, 0x00)), 0xFF000000u);
+	}
+
+	// 1배, 2배, 4배 캔버스에서 이전 GridCanvas::FillRect() 방식(첫 줄을 픽셀마다 memcpy, 나머지 줄 복사)과 PixelKernels::FillRect()의 속도 비교
+	// 실행: --gtest_also_run_disabled_tests --gtest_filter=*Benchmark*
+	TEST(UnitTest_PixelKernels, DISABLED_Benchmark_FillCanvas)
+	{
+		for (const size_t scale : {1u, 2u, 4u})
+		{
+			const size_t cellSize = 10 * scale;
+			const size_t cellStride = 13 * scale;
+			const size_t width = 53 * cellStride - 3 * scale;
+			const size_t height = 7 * cellStride - 3 * scale;
+			const size_t stride = width * 4;
+			const int repeatCount = 200;
+
+			std::vector<uint8_t> canvas(stride * height);
+			const COLORREF color = RGB(0x21, 0x6e, 0x39);
+
+			// 전체 캔버스를 한 번 채우고 모든 셀을 한 번씩 칠하는 것을 한 프레임으로 측정
+			const auto measure = [&](const auto& fillRect)
+			{
+				const auto begin = std::chrono::steady_clock::now();
+				for (int repeat = 0; repeat < repeatCount; ++repeat)
+				{
+					fillRect(canvas.data(), width, height);
+					for (size_t week = 0; week < 53; ++week)
+					{
+						for (size_t day = 0; day < 7; ++day)
+							fillRect(canvas.data() + day * cellStride * stride + week * cellStride * 4, cellSize, cellSize);
+					}
+				}
+				const auto elapsed = std::chrono::steady_clock::now() - begin;
+				return std::chrono::duration<double, std::micro>(elapsed).count() / repeatCount;
+			};
+
+			const double baselineMicroseconds = measure([&](uint8_t* origin, const size_t w, const size_t h)
+			{
+				const uint8_t pixel[4] = {GetRValue(color), GetGValue(color), GetBValue(color), 0xFF};
+				for (size_t offset = 0; offset < w * 4; offset += 4)
+					memcpy(origin + offset, pixel, 4);
+				for (size_t y = 1; y < h; ++y)
+					memcpy(origin + y * stride, origin, w * 4);
+			});
+			std::printf("[ BENCH    ] %zux canvas %zux%zu: row copy %.1f us/frame\n", scale, width, height,
+			            baselineMicroseconds);
+
+			const double fillMicroseconds = measure([&](uint8_t* origin, const size_t w, const size_t h)
+			{
+				PixelKernels::FillRect(origin, stride, w, h, PixelKernels::ToPixel(color));
+			});
+			std::printf("[ BENCH    ] %zux canvas: FillRect %.1f us/frame (%.2fx)\n", scale, fillMicroseconds,
+			            baselineMicroseconds / fillMicroseconds);
+		}
+	}
+}	// namespace CoTigraphy
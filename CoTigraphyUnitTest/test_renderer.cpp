@@ -0,0 +1,275 @@
+﻿// \file test_renderer.cpp
+// \last_updated 2026-10-16
+// \author Oh Sungsik <ohsungsik@outlook.com>
+// \copyright (C) 2025. Oh Sungsik. All rights reserved.
+
+#include "pch.hpp"
+#include <Renderer.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <webp/demux.h>
+
+#include "test_grid_data.hpp"
+
+namespace CoTigraphy
+{
+	class UnitTest_RenderSimulationLog : public ::testing::Test
+	{
+	protected:
+		static void SetUpTestSuite()
+		{
+			GitHubContributionCalendarClient::GlobalInitialize();
+		}
+
+		static void TearDownTestSuite()
+		{
+			GitHubContributionCalendarClient::GlobalUninitialize();
+		}
+
+		static SimulationLog MakeSimulationLog()
+		{
+			SimulationLog simulationLog;
+			Renderer::Simulate(MakePatternGridData(12), eRouteStrategy::Greedy, simulationLog);
+			return simulationLog;
+		}
+
+		static std::filesystem::path MakeTempPath(_In_ const std::wstring& name)
+		{
+			return std::filesystem::temp_directory_path() / (L"CoTigraphy_" + name + L".webp");
+		}
+
+		/**
+		 * @brief 파일 내용을 읽고 파일은 지움
+		 */
+		static std::vector<char> ReadAndRemove(_In_ const std::filesystem::path& path)
+		{
+			std::ifstream file(path, std::ios::binary);
+			std::vector<char> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+			file.close();
+			std::filesystem::remove(path);
+			return bytes;
+		}
+
+		/**
+		 * @brief Renderer로 기록을 렌더링하고 출력 이름(suffix)마다 파일 내용을 반환
+		 */
+		static std::vector<std::vector<char>> Render(_In_ const SimulationLog& simulationLog,
+		                                             _In_ const RenderOptions& renderOptions,
+		                                             _In_ const std::vector<std::wstring>& suffixes)
+		{
+			const std::filesystem::path outputPath = MakeTempPath(L"renderer");
+
+			Renderer renderer;
+			renderer.Initialize(L"", renderOptions);
+			EXPECT_TRUE(renderer.RenderSimulationLog(simulationLog, outputPath.wstring()).IsSucceeded());
+			renderer.Uninitialize();
+
+			std::vector<std::vector<char>> outputs;
+			for (const std::wstring& suffix : suffixes)
+			{
+				outputs.push_back(ReadAndRemove(Renderer::MakeOutputPath(outputPath.wstring(), suffix)));
+				EXPECT_FALSE(outputs.back().empty()) << std::string(suffix.begin(), suffix.end());
+			}
+			return outputs;
+		}
+
+		/**
+		 * @brief WebP 애니메이션을 디코딩해 프레임마다 끝나는 시각(ms)을 반환 (프레임 수와 누적 표시 시간)
+		 */
+		static std::vector<int> DecodeTimestamps(_In_ const std::vector<char>& bytes)
+		{
+			std::vector<int> timestamps;
+
+			const WebPData data{reinterpret_cast<const uint8_t*>(bytes.data()), bytes.size()};
+			WebPAnimDecoder* const decoder = WebPAnimDecoderNew(&data, nullptr);
+			if (decoder == nullptr)
+			{
+				ADD_FAILURE() << "WebPAnimDecoderNew() failed";
+				return timestamps;
+			}
+
+			while (WebPAnimDecoderHasMoreFrames(decoder))
+			{
+				uint8_t* pixels = nullptr;
+				int timestamp = 0;
+				if (WebPAnimDecoderGetNext(decoder, &pixels, &timestamp) == 0)
+				{
+					ADD_FAILURE() << "WebPAnimDecoderGetNext() failed";
+					break;
+				}
+				timestamps.push_back(timestamp);
+			}
+
+			WebPAnimDecoderDelete(decoder);
+			return timestamps;
+		}
+
+		/**
+		 * @brief WebP 애니메이션을 디코딩해 프레임마다 합성된 캔버스(RGBA)를 반환
+		 */
+		static std::vector<std::vector<uint8_t>> DecodeFrames(_In_ const std::vector<char>& bytes)
+		{
+			std::vector<std::vector<uint8_t>> frames;
+
+			const WebPData data{reinterpret_cast<const uint8_t*>(bytes.data()), bytes.size()};
+			WebPAnimDecoder* const decoder = WebPAnimDecoderNew(&data, nullptr);
+			if (decoder == nullptr)
+			{
+				ADD_FAILURE() << "WebPAnimDecoderNew() failed";
+				return frames;
+			}
+
+			WebPAnimInfo animInfo;
+			if (WebPAnimDecoderGetInfo(decoder, &animInfo) == 0)
+			{
+				ADD_FAILURE() << "WebPAnimDecoderGetInfo() failed";
+				WebPAnimDecoderDelete(decoder);
+				return frames;
+			}
+
+			const size_t frameSize = static_cast<size_t>(animInfo.canvas_width) * animInfo.canvas_height * 4;
+			while (WebPAnimDecoderHasMoreFrames(decoder))
+			{
+				uint8_t* pixels = nullptr;
+				int timestamp = 0;
+				if (WebPAnimDecoderGetNext(decoder, &pixels, &timestamp) == 0)
+				{
+					ADD_FAILURE() << "WebPAnimDecoderGetNext() failed";
+					break;
+				}
+				frames.emplace_back(pixels, pixels + frameSize);
+			}
+
+			WebPAnimDecoderDelete(decoder);
+			return frames;
+		}
+	};
+
+	// 확장자 앞에 출력 이름을 붙임 (디렉터리 이름의 '.'은 무시)
+	TEST(UnitTest_Renderer, MakeOutputPath)
+	{
+		EXPECT_EQ(Renderer::MakeOutputPath(L"out/banner.webp", L"-dark@2x"), L"out/banner-dark@2x.webp");
+		EXPECT_EQ(Renderer::MakeOutputPath(L"C:\\my.dir\\banner", L"@3x"), L"C:\\my.dir\\banner@3x");
+		EXPECT_EQ(Renderer::MakeOutputPath(L"banner.webp", L""), L"banner.webp");
+	}
+
+	// 출력 크기는 WEBP_MAX_DIMENSION(16383) 이하, 간격 0은 허용
+	TEST(UnitTest_Renderer, IsOutputSizeSupported)
+	{
+		EXPECT_TRUE(Renderer::IsOutputSizeSupported(53, 10, 3, 1));
+		EXPECT_TRUE(Renderer::IsOutputSizeSupported(53, 10, 0, 1));
+		EXPECT_TRUE(Renderer::IsOutputSizeSupported(54, 10, 3, 23)); // 699 × 23 = 16077
+		EXPECT_FALSE(Renderer::IsOutputSizeSupported(54, 10, 3, 24)); // 699 × 24 = 16776
+		EXPECT_FALSE(Renderer::IsOutputSizeSupported(53, 10, 3, 30));
+		EXPECT_FALSE(Renderer::IsOutputSizeSupported(53, 0, 3, 1));
+		EXPECT_FALSE(Renderer::IsOutputSizeSupported(53, 10, 3, std::numeric_limits<size_t>::max()));
+		EXPECT_FALSE(Renderer::IsOutputSizeSupported(53, std::numeric_limits<size_t>::max(), 3, 1));
+	}
+
+	// 셀 크기 목록으로 함께 그린 출력은 그 셀 크기/간격 하나로 그린 출력과 같아야 함
+	TEST_F(UnitTest_RenderSimulationLog, CellLayoutsMatchSingleLayout)
+	{
+		const SimulationLog simulationLog = MakeSimulationLog();
+		const std::vector<CellLayout> cellLayouts = {{5, 1}, {10, 3}, {20, 6}};
+
+		RenderOptions renderOptions;
+		renderOptions.mCellLayouts = cellLayouts;
+		const std::vector<std::vector<char>> outputs = Render(simulationLog, renderOptions, {L"-5px", L"-10px", L"-20px"});
+
+		for (size_t i = 0; i < cellLayouts.size(); ++i)
+		{
+			SCOPED_TRACE(cellLayouts[i].mCellSize);
+
+			RenderOptions singleOptions;
+			singleOptions.mCellSize = cellLayouts[i].mCellSize;
+			singleOptions.mCellMargin = cellLayouts[i].mCellMargin;
+			EXPECT_EQ(outputs[i], Render(simulationLog, singleOptions, {L""}).front());
+		}
+	}
+
+	// libwebp가 프레임을 거부하면 프로세스를 끝내지 않고 EncodingFailure를 반환해야 함 (배치 렌더링의 다른 작업은 계속)
+	TEST_F(UnitTest_RenderSimulationLog, EncoderFailureReturnsEncodingFailure)
+	{
+		const SimulationLog simulationLog = MakeSimulationLog();
+		const std::filesystem::path outputPath = MakeTempPath(L"encoder_failure");
+
+		for (const eFrameWriterType frameWriterType : {eFrameWriterType::AnimEncoder, eFrameWriterType::SubRectMux})
+		{
+			for (const size_t encodeThreadCount : {size_t{0}, size_t{2}})
+			{
+				SCOPED_TRACE(static_cast<int>(frameWriterType));
+				SCOPED_TRACE(encodeThreadCount);
+
+				// 명령줄 파서가 거부하는 값 (WebPValidateConfig()에서 실패해 모든 프레임의 인코딩이 실패)
+				RenderOptions renderOptions;
+				renderOptions.mFrameWriterType = frameWriterType;
+				renderOptions.mEncodeThreadCount = encodeThreadCount;
+				renderOptions.mEncodeOptions.mThreadLevel = 2;
+
+				Renderer renderer;
+				renderer.Initialize(L"", renderOptions);
+				EXPECT_EQ(renderer.RenderSimulationLog(simulationLog, outputPath.wstring()), eErrorCode::EncodingFailure);
+				renderer.Uninitialize();
+
+				EXPECT_FALSE(std::filesystem::exists(outputPath));
+			}
+		}
+	}
+
+	// 프레임 수와 표시 시간은 렌더링 경로(--encode_threads 0: 단일 파이프라인, N: chunk 병렬 인코딩)와 무관해야 함
+	TEST_F(UnitTest_RenderSimulationLog, FrameTimingMatchesAcrossEncodeThreads)
+	{
+		SimulationLog simulationLog;
+		Renderer::Simulate(MakePatternGridData(30), eRouteStrategy::Greedy, simulationLog);
+
+		for (const eFrameWriterType frameWriterType : {eFrameWriterType::AnimEncoder, eFrameWriterType::SubRectMux})
+		{
+			for (const eTimeline timeline : {eTimeline::Uniform, eTimeline::Dynamic})
+			{
+				SCOPED_TRACE(static_cast<int>(frameWriterType));
+				SCOPED_TRACE(static_cast<int>(timeline));
+
+				RenderOptions renderOptions;
+				renderOptions.mFrameWriterType = frameWriterType;
+				renderOptions.mTimeline = timeline;
+				const std::vector<int> pipelineTimestamps = DecodeTimestamps(Render(simulationLog, renderOptions, {L""}).front());
+
+				renderOptions.mEncodeThreadCount = 3;
+				const std::vector<int> chunkedTimestamps = DecodeTimestamps(Render(simulationLog, renderOptions, {L""}).front());
+
+				// chunk(64 프레임) 경계를 여러 번 지나야 함
+				ASSERT_GT(pipelineTimestamps.size(), 2u * 64u);
+				EXPECT_EQ(pipelineTimestamps, chunkedTimestamps);
+			}
+		}
+	}
+
+	// 파이프라인 버퍼에 바뀐 줄만 복사해도 디코딩한 프레임은 캔버스를 그대로 인코딩하는 chunk 병렬 인코딩과 같아야 함 (무손실)
+	TEST_F(UnitTest_RenderSimulationLog, PipelineFramesMatchChunkedFrames)
+	{
+		const SimulationLog simulationLog = MakeSimulationLog();
+
+		for (const eFrameWriterType frameWriterType : {eFrameWriterType::AnimEncoder, eFrameWriterType::SubRectMux})
+		{
+			SCOPED_TRACE(static_cast<int>(frameWriterType));
+
+			RenderOptions renderOptions;
+			renderOptions.mFrameWriterType = frameWriterType;
+			renderOptions.mEncodeOptions.mLossless = true;
+			const std::vector<std::vector<uint8_t>> pipelineFrames = DecodeFrames(
+				Render(simulationLog, renderOptions, {L""}).front());
+
+			renderOptions.mEncodeThreadCount = 3;
+			const std::vector<std::vector<uint8_t>> chunkedFrames = DecodeFrames(
+				Render(simulationLog, renderOptions, {L""}).front());
+
+			// 파이프라인 버퍼(4개)를 여러 번 재사용해야 함
+			ASSERT_GT(pipelineFrames.size(), 4u * 4u);
+			ASSERT_EQ(pipelineFrames.size(), chunkedFrames.size());
+			for (size_t frame = 0; frame < pipelineFrames.size(); ++frame)
+				ASSERT_EQ(pipelineFrames[frame], chunkedFrames[frame]) << "frame " << frame;
+		}
+	}
+}	// namespace CoTigraphy
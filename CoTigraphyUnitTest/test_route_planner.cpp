@@ -0,0 +1,68 @@
+﻿// \file test_route_planner.cpp
+// \last_updated 2026-10-16
+// \author Oh Sungsik <ohsungsik@outlook.com>
+// \copyright (C) 2025. Oh Sungsik. All rights reserved.
+
+#include "pch.hpp"
+#include <Renderer.hpp>
+#include <RoutePlanner.hpp>
+#include <Worm.hpp>
+
+#include "test_grid_data.hpp"
+
+namespace CoTigraphy
+{
+	class UnitTest_RoutePlanner : public ::testing::Test
+	{
+	protected:
+		static GridData MakeGridData()
+		{
+			return MakeTestGridData(53, 7, [](const size_t week, const size_t day) -> uint64_t
+			{
+				return ((week * 11 + day * 7) % 5 == 0) ? (week + day) % 3 + 1 : 0;
+			}, [](const uint64_t) { return RGB(0x30, 0x90, 0x30); });
+		}
+	};
+
+	// 계획된 순서는 같은 목표 셀의 순열이며, 입력 순서보다 길지 않아야 함
+	TEST_F(UnitTest_RoutePlanner, Plan_ReordersWithoutLengthening)
+	{
+		const POINT start = {0, 0};
+		std::vector<POINT> targets;
+		for (LONG week = 52; week >= 0; week -= 4)
+		{
+			targets.push_back(POINT{week, 6});
+			targets.push_back(POINT{52 - week, 0});
+		}
+
+		std::vector<POINT> planned = targets;
+		RoutePlanner routePlanner;
+		routePlanner.Plan(start, planned);
+
+		ASSERT_EQ(planned.size(), targets.size());
+		EXPECT_TRUE(std::is_permutation(planned.begin(), planned.end(), targets.begin(),
+			[](const POINT& lhs, const POINT& rhs) { return lhs.x == rhs.x && lhs.y == rhs.y; }));
+
+		EXPECT_LT(RoutePlanner::GetRouteLength(start, planned), RoutePlanner::GetRouteLength(start, targets));
+	}
+
+	// 계획된 순서로 이동해도 모든 셀을 먹어야 하며, greedy보다 이동 횟수가 많지 않아야 함
+	TEST_F(UnitTest_RoutePlanner, Simulate_OptimizedEatsEveryCellInFewerMoves)
+	{
+		const GridData gridData = MakeGridData();
+
+		SimulationLog greedyLog;
+		Renderer::Simulate(gridData, eRouteStrategy::Greedy, greedyLog);
+
+		SimulationLog optimizedLog;
+		Renderer::Simulate(gridData, eRouteStrategy::Optimized, optimizedLog);
+
+		Grid grid(gridData);
+		Worm worm(grid);
+		for (const SimulationEvent& simulationEvent : optimizedLog.GetEvents())
+			worm.Apply(simulationEvent);
+
+		EXPECT_FALSE(grid.HasContributionAtOrBelow(gridData.mMaxCount));
+		EXPECT_LE(optimizedLog.GetEvents().size(), greedyLog.GetEvents().size());
+	}
+}	// namespace CoTigraphy
@@ -0,0 +1,143 @@
+﻿// \file test_simulation_log.cpp
+// \last_updated 2026-10-16
+// \author Oh Sungsik <ohsungsik@outlook.com>
+// \copyright (C) 2025. Oh Sungsik. All rights reserved.
+
+#include "pch.hpp"
+#include <Renderer.hpp>
+#include <SimulationLog.hpp>
+#include <Worm.hpp>
+
+#include "test_grid_data.hpp"
+
+#include <sstream>
+
+namespace CoTigraphy
+{
+	class UnitTest_SimulationLog : public ::testing::Test
+	{
+	protected:
+		static GridData MakeGridData()
+		{
+			return MakePatternGridData(10);
+		}
+	};
+
+	// 저장 후 다시 읽으면 Grid와 이벤트가 그대로 복원되어야 함
+	TEST_F(UnitTest_SimulationLog, WriteRead_RoundTrip)
+	{
+		SimulationLog original;
+		Renderer::Simulate(MakeGridData(), eRouteStrategy::Greedy, original);
+		ASSERT_FALSE(original.GetEvents().empty());
+
+		std::stringstream stream(std::ios::in | std::ios::out | std::ios::binary);
+		ASSERT_TRUE(original.WriteTo(stream).IsSucceeded());
+
+		SimulationLog loaded;
+		ASSERT_TRUE(loaded.ReadFrom(stream).IsSucceeded());
+
+		const GridData& expectedGrid = original.GetGridData();
+		const GridData& actualGrid = loaded.GetGridData();
+		EXPECT_EQ(actualGrid.mWeekCount, expectedGrid.mWeekCount);
+		EXPECT_EQ(actualGrid.mDayCount, expectedGrid.mDayCount);
+		EXPECT_EQ(actualGrid.mMaxCount, expectedGrid.mMaxCount);
+		for (size_t week = 0; week < expectedGrid.mWeekCount; ++week)
+		{
+			for (size_t day = 0; day < expectedGrid.mDayCount; ++day)
+			{
+				EXPECT_EQ(actualGrid.mCells[week][day].mCount, expectedGrid.mCells[week][day].mCount);
+				EXPECT_EQ(actualGrid.mCells[week][day].mColor, expectedGrid.mCells[week][day].mColor);
+			}
+		}
+
+		ASSERT_EQ(loaded.GetEvents().size(), original.GetEvents().size());
+		EXPECT_EQ(memcmp(loaded.GetEvents().data(), original.GetEvents().data(),
+		                 original.GetEvents().size() * sizeof(SimulationEvent)), 0);
+	}
+
+	// 이벤트 재생 결과가 BFS 시뮬레이션 결과와 같아야 함
+	TEST_F(UnitTest_SimulationLog, Apply_MatchesMove)
+	{
+		const GridData gridData = MakeGridData();
+
+		SimulationLog simulationLog;
+		Renderer::Simulate(gridData, eRouteStrategy::Greedy, simulationLog);
+
+		Grid simulatedGrid(gridData);
+		Worm simulatedWorm(simulatedGrid);
+		Grid replayedGrid(gridData);
+		Worm replayedWorm(replayedGrid);
+
+		size_t eventIndex = 0;
+		uint64_t currentLevel = 1;
+		while (currentLevel <= gridData.mMaxCount)
+		{
+			if (simulatedWorm.Move(currentLevel) == false)
+			{
+				currentLevel++;
+				continue;
+			}
+
+			ASSERT_LT(eventIndex, simulationLog.GetEvents().size());
+			replayedWorm.Apply(simulationLog.GetEvents()[eventIndex++]);
+
+			const auto simulatedSegments = simulatedWorm.GetWorm();
+			const auto replayedSegments = replayedWorm.GetWorm();
+			for (size_t i = 0; i < simulatedSegments.size(); ++i)
+			{
+				EXPECT_EQ(replayedSegments[i].mPoint.x, simulatedSegments[i].mPoint.x);
+				EXPECT_EQ(replayedSegments[i].mPoint.y, simulatedSegments[i].mPoint.y);
+			}
+		}
+
+		EXPECT_EQ(eventIndex, simulationLog.GetEvents().size());
+		for (size_t week = 0; week < simulatedGrid.GetWeekCount(); ++week)
+		{
+			for (size_t day = 0; day < simulatedGrid.GetDayCount(); ++day)
+			{
+				EXPECT_EQ(replayedGrid.GetContributionCount(week, day), simulatedGrid.GetContributionCount(week, day));
+				EXPECT_EQ(replayedGrid.GetColor(week, day), simulatedGrid.GetColor(week, day));
+			}
+		}
+	}
+
+	// 형식이 다른 데이터는 거부
+	TEST_F(UnitTest_SimulationLog, ReadFrom_FailsOnInvalidData)
+	{
+		SimulationLog simulationLog;
+
+		std::stringstream wrongMagic(std::string("XXXX\x01\x00\x00\x00", 8),
+		                             std::ios::in | std::ios::binary);
+		Error error = simulationLog.ReadFrom(wrongMagic);
+		EXPECT_TRUE(error.IsFailed());
+		EXPECT_EQ(error, eErrorCode::InvalidSimulationLog);
+
+		// 정상 기록을 중간에서 자른 경우
+		SimulationLog original;
+		Renderer::Simulate(MakeGridData(), eRouteStrategy::Greedy, original);
+		std::stringstream full(std::ios::in | std::ios::out | std::ios::binary);
+		ASSERT_TRUE(original.WriteTo(full).IsSucceeded());
+
+		const std::string bytes = full.str();
+		std::stringstream truncated(bytes.substr(0, bytes.size() - 3), std::ios::in | std::ios::binary);
+		error = simulationLog.ReadFrom(truncated);
+		EXPECT_EQ(error, eErrorCode::InvalidSimulationLog);
+		EXPECT_TRUE(simulationLog.GetEvents().empty());
+
+		// 요일 수가 0인 경우 (magic 4 + version 4 + weekCount 4 바이트 뒤)
+		std::string zeroDays = bytes;
+		memset(zeroDays.data() + 12, 0, sizeof(uint32_t));
+		std::stringstream zeroDayStream(zeroDays, std::ios::in | std::ios::binary);
+		EXPECT_EQ(simulationLog.ReadFrom(zeroDayStream), eErrorCode::InvalidSimulationLog);
+
+		// 먹을 셀이 없어 이벤트가 하나도 없는 경우
+		SimulationLog empty;
+		Renderer::Simulate(MakeTestGridData(10, 7, [](const size_t, const size_t) { return uint64_t{0}; },
+		                                    [](const uint64_t) { return RGB(0xEB, 0xED, 0xF0); }),
+		                   eRouteStrategy::Greedy, empty);
+		ASSERT_TRUE(empty.GetEvents().empty());
+		std::stringstream noEvents(std::ios::in | std::ios::out | std::ios::binary);
+		ASSERT_TRUE(empty.WriteTo(noEvents).IsSucceeded());
+		EXPECT_EQ(simulationLog.ReadFrom(noEvents), eErrorCode::InvalidSimulationLog);
+	}
+}	// namespace CoTigraphy
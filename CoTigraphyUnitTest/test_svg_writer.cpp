@@ -0,0 +1,101 @@
+﻿// \file test_svg_writer.cpp
+// \last_updated 2026-10-16
+// \author Oh Sungsik <ohsungsik@outlook.com>
+// \copyright (C) 2025. Oh Sungsik. All rights reserved.
+
+#include "pch.hpp"
+#include <SvgWriter.hpp>
+
+#include "test_grid_data.hpp"
+
+namespace CoTigraphy
+{
+	class UnitTest_SvgWriter : public ::testing::Test
+	{
+	protected:
+		// 5주 × 7일, (4, 0)에만 Contribution이 있고 지렁이가 그 셀을 먹은 뒤 (4, 1)로 이동
+		static void MakeSimulationLog(_Out_ SimulationLog& outSimulationLog)
+		{
+			const GridData gridData = MakeTestGridData(5, 7, [](const size_t week, const size_t day) -> uint64_t
+			{
+				return (week == 4 && day == 0) ? 1 : 0;
+			}, [](const uint64_t count) { return count > 0 ? RGB(0x21, 0x6E, 0x39) : RGB(0xEB, 0xED, 0xF0); });
+
+			outSimulationLog.Reset(gridData);
+			outSimulationLog.Record(SimulationEvent{4, 0, static_cast<uint8_t>(eSimulationEventFlag::AteContribution),
+			                                        RGB(0xFF, 0xFF, 0xFF)});
+			outSimulationLog.Record(SimulationEvent{4, 1, 0, RGB(0xFF, 0xFF, 0xFF)});
+		}
+
+		static GridCanvasContext MakeContext()
+		{
+			GridCanvasContext context;
+			context.mWidth = (5 * 13 - 3) * 2;
+			context.mHeight = (7 * 13 - 3) * 2;
+			context.mCellSize = 10;
+			context.mCellMargin = 3;
+			context.mScale = 2;
+			return context;
+		}
+
+		static size_t CountOf(_In_ const std::string& text, _In_ const std::string& pattern)
+		{
+			size_t count = 0;
+			for (size_t pos = text.find(pattern); pos != std::string::npos; pos = text.find(pattern, pos + 1))
+				++count;
+			return count;
+		}
+	};
+
+	// 배경 1개 + 셀 35개 + 지렁이 4개, 첫 프레임 이후에 바뀐 셀만 애니메이션
+	TEST_F(UnitTest_SvgWriter, Write_Uniform)
+	{
+		SimulationLog simulationLog;
+		MakeSimulationLog(simulationLog);
+
+		SvgWriter svgWriter;
+		svgWriter.Write(simulationLog, MakeContext(), eTimeline::Uniform);
+		const std::string& svg = svgWriter.GetData();
+
+		EXPECT_NE(svg.find(R"(width="124" height="176" viewBox="0 0 62 88")"), std::string::npos);
+		EXPECT_EQ(CountOf(svg, "<rect"), 40u);
+		EXPECT_EQ(CountOf(svg, "<animate "), 1u); // (4, 0)은 첫 프레임에서 이미 먹힘
+		EXPECT_EQ(CountOf(svg, "<animateTransform"), 4u);
+		EXPECT_NE(svg.find(R"(values="#ebedf0;#ffffff" keyTimes="0;0.5" dur="160ms")"), std::string::npos);
+		EXPECT_EQ(CountOf(svg, R"(values="52,0;52,13" dur="160ms")"), 1u); // 같은 간격이면 keyTimes 생략
+	}
+
+	// Dynamic은 먹는 프레임 160ms, 마지막 프레임 40ms + 2000ms
+	TEST_F(UnitTest_SvgWriter, Write_DynamicWithColorTable)
+	{
+		SimulationLog simulationLog;
+		MakeSimulationLog(simulationLog);
+
+		GridCanvasContext context = MakeContext();
+		context.mColorTable = {{RGB(0xFF, 0xFF, 0xFF), RGB(0x16, 0x1B, 0x22)}};
+
+		SvgWriter svgWriter;
+		svgWriter.Write(simulationLog, context, eTimeline::Dynamic);
+		const std::string& svg = svgWriter.GetData();
+
+		EXPECT_EQ(svg.find("#ffffff"), std::string::npos);
+		EXPECT_NE(svg.find(R"(values="#ebedf0;#161b22" keyTimes="0;0.07273" dur="2200ms")"), std::string::npos);
+		EXPECT_EQ(CountOf(svg, R"(keyTimes="0;0.07273")"), 5u);
+	}
+
+	// 출력 확장자는 .svg만 허용 (대소문자 무시)
+	TEST_F(UnitTest_SvgWriter, FileExtension)
+	{
+		EXPECT_TRUE(SvgWriter::IsSvgFileName(L"out/banner.svg"));
+		EXPECT_TRUE(SvgWriter::IsSvgFileName(L"BANNER.SVG"));
+		EXPECT_FALSE(SvgWriter::IsSvgFileName(L"banner.webp"));
+		EXPECT_FALSE(SvgWriter::IsSvgFileName(L"svg"));
+
+		SimulationLog simulationLog;
+		MakeSimulationLog(simulationLog);
+
+		SvgWriter svgWriter;
+		svgWriter.Write(simulationLog, MakeContext(), eTimeline::Uniform);
+		EXPECT_EQ(svgWriter.SaveToFile(L"banner.webp").GetErrorCode(), eErrorCode::InvalidFileExtension);
+	}
+}	// namespace CoTigraphy
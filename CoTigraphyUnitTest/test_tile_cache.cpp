@@ -0,0 +1,158 @@
+﻿// \file test_tile_cache.cpp
+// \last_updated 2026-10-16
+// \author Oh Sungsik <ohsungsik@outlook.com>
+// \copyright (C) 2025. Oh Sungsik. All rights reserved.
+
+#include "pch.hpp"
+#include <TileCache.hpp>
+
+#include <thread>
+
+namespace CoTigraphy
+{
+	// 같은 키는 스레드와 관계없이 같은 타일을 반환해야 함 (한 번만 래스터화)
+	TEST(UnitTest_TileCache, GetTile_ReturnsSameTileForSameKey)
+	{
+		TileCache tileCache;
+
+		TileKey tileKey;
+		tileKey.mColor = RGB(0x12, 0x34, 0x56);
+		tileKey.mScaleStep = TileKey::QuantizeScale(1.0f);
+		tileKey.mCellSize = 10;
+		tileKey.mPixelFormat = ePixelFormat::ARGB;
+
+		std::vector<const CellTile*> tiles(8, nullptr);
+		std::vector<std::thread> threads;
+		for (size_t i = 0; i < tiles.size(); ++i)
+		{
+			threads.emplace_back([&tileCache, &tileKey, &tiles, i]()
+			{
+				tiles[i] = tileCache.GetTile(tileKey).get();
+			});
+		}
+		for (std::thread& thread : threads)
+			thread.join();
+
+		for (const CellTile* cellTile : tiles)
+			EXPECT_EQ(cellTile, tiles[0]);
+		EXPECT_EQ(tileCache.GetTileCount(), 1u);
+
+		// 픽셀 형식이 다르면 다른 타일
+		tileKey.mPixelFormat = ePixelFormat::YUV420;
+		EXPECT_NE(tileCache.GetTile(tileKey).get(), tiles[0]);
+		EXPECT_EQ(tileCache.GetTileCount(), 2u);
+
+		// 양자화 단위보다 작은 크기 비율 차이는 같은 키
+		EXPECT_EQ(TileKey::QuantizeScale(0.5f), TileKey::QuantizeScale(std::nextafter(0.5f, 1.0f)));
+
+		// Clear() 후에는 타일을 다시 래스터화
+		tileCache.Clear();
+		EXPECT_EQ(tileCache.GetTileCount(), 0u);
+	}
+
+	// 바이트 수 상한을 넘으면 보관한 타일을 비우되, 이미 받은 타일은 계속 사용할 수 있어야 함
+	TEST(UnitTest_TileCache, GetTile_DropsTilesOverByteLimit)
+	{
+		constexpr size_t tileByteSize = 10 * 10 * 4; // 10×10 ARGB 직각 셀 (덮는 비율 없음)
+		TileCache tileCache(tileByteSize * 2);
+
+		TileKey tileKey;
+		tileKey.mColor = RGB(0x12, 0x34, 0x56);
+		tileKey.mScaleStep = TileKey::QuantizeScale(1.0f);
+		tileKey.mCellSize = 10;
+		tileKey.mPixelFormat = ePixelFormat::ARGB;
+
+		const std::shared_ptr<const CellTile> firstTile = tileCache.GetTile(tileKey);
+		tileKey.mColor = RGB(0x21, 0x6E, 0x39);
+		static_cast<void>(tileCache.GetTile(tileKey));
+		EXPECT_EQ(tileCache.GetTileCount(), 2u);
+		EXPECT_EQ(tileCache.GetByteSize(), tileByteSize * 2);
+
+		tileKey.mColor = RGB(0xFF, 0xA5, 0x00);
+		static_cast<void>(tileCache.GetTile(tileKey));
+		EXPECT_EQ(tileCache.GetTileCount(), 1u);
+		EXPECT_EQ(tileCache.GetByteSize(), tileByteSize);
+
+		ASSERT_EQ(firstTile->mPixels.size(), tileByteSize);
+		EXPECT_EQ(reinterpret_cast<const uint32_t*>(firstTile->mPixels.data())[0], 0xFF123456u);
+
+		// 비워진 타일은 다시 래스터화
+		tileKey.mColor = RGB(0x12, 0x34, 0x56);
+		EXPECT_NE(tileCache.GetTile(tileKey), firstTile);
+	}
+
+	// 타일은 셀 중심 기준으로 줄인 영역을 지정한 색상으로 채우고, 반만 덮인 가장자리 픽셀은 덮는 비율로 표시해야 함
+	TEST(UnitTest_TileCache, GetTile_RasterizesScaledCell)
+	{
+		TileCache tileCache;
+
+		TileKey tileKey;
+		tileKey.mColor = RGB(0x12, 0x34, 0x56);
+		tileKey.mScaleStep = TileKey::QuantizeScale(0.5f);
+		tileKey.mCellSize = 10;
+		tileKey.mPixelFormat = ePixelFormat::ARGB;
+
+		// 5픽셀 셀이 [2.5, 7.5)에 놓이므로 [2, 8) 픽셀에 걸침
+		const CellTile& cellTile = *tileCache.GetTile(tileKey);
+		EXPECT_EQ(cellTile.mRect.left, 2);
+		EXPECT_EQ(cellTile.mRect.top, 2);
+		EXPECT_EQ(cellTile.mRect.right, 8);
+		EXPECT_EQ(cellTile.mRect.bottom, 8);
+
+		ASSERT_EQ(cellTile.mPixels.size(), 6u * 6u * 4u);
+		const uint32_t* const pixels = reinterpret_cast<const uint32_t*>(cellTile.mPixels.data());
+		for (size_t i = 0; i < 6u * 6u; ++i)
+			EXPECT_EQ(pixels[i], 0xFF123456u);
+
+		ASSERT_EQ(cellTile.mCoverage.size(), 6u * 6u);
+		EXPECT_EQ(cellTile.mCoverage[0], 64); // 모서리: 1/4
+		EXPECT_EQ(cellTile.mCoverage[1], 128); // 가장자리: 1/2
+		EXPECT_EQ(cellTile.mCoverage[1 * 6 + 1], 255); // 안쪽
+		EXPECT_EQ(cellTile.mCoverage[5 * 6 + 5], 64);
+
+		// YUV420 타일은 Y, R, G, B 평면을 차례로 가짐
+		tileKey.mPixelFormat = ePixelFormat::YUV420;
+		const CellTile& yuvTile = *tileCache.GetTile(tileKey);
+		ASSERT_EQ(yuvTile.mPixels.size(), 4u * 6u * 6u);
+		EXPECT_EQ(yuvTile.mPixels[0], PixelKernels::ToLuma(tileKey.mColor));
+		EXPECT_EQ(yuvTile.mPixels[36], 0x12);
+		EXPECT_EQ(yuvTile.mPixels[72], 0x34);
+		EXPECT_EQ(yuvTile.mPixels[108], 0x56);
+	}
+
+	// 원래 크기의 직각 셀은 섞을 필요가 없고, 둥근 모서리는 바깥으로 갈수록 덜 덮여야 함
+	TEST(UnitTest_TileCache, GetTile_CoverageForCornerRadius)
+	{
+		TileCache tileCache;
+
+		TileKey tileKey;
+		tileKey.mColor = RGB(0x12, 0x34, 0x56);
+		tileKey.mScaleStep = TileKey::QuantizeScale(1.0f);
+		tileKey.mCellSize = 10;
+		tileKey.mPixelFormat = ePixelFormat::ARGB;
+
+		EXPECT_TRUE(tileCache.GetTile(tileKey)->mCoverage.empty());
+
+		tileKey.mCornerRadius = 3;
+		const CellTile& roundTile = *tileCache.GetTile(tileKey);
+		EXPECT_EQ(roundTile.mRect.left, 0);
+		EXPECT_EQ(roundTile.mRect.right, 10);
+		ASSERT_EQ(roundTile.mCoverage.size(), 10u * 10u);
+
+		const auto coverageAt = [&roundTile](const size_t x, const size_t y)
+		{
+			return roundTile.mCoverage[y * 10 + x];
+		};
+		EXPECT_LT(coverageAt(0, 0), 64);
+		EXPECT_LT(coverageAt(0, 0), coverageAt(0, 1));
+		EXPECT_LT(coverageAt(0, 1), 255);
+		EXPECT_EQ(coverageAt(1, 1), 255); // 모서리 원 안쪽
+		EXPECT_EQ(coverageAt(3, 0), 255); // 모서리 원 바깥의 직선 가장자리
+		EXPECT_EQ(coverageAt(5, 5), 255);
+
+		// 네 모서리는 대칭
+		EXPECT_EQ(coverageAt(0, 0), coverageAt(9, 0));
+		EXPECT_EQ(coverageAt(0, 0), coverageAt(0, 9));
+		EXPECT_EQ(coverageAt(1, 0), coverageAt(8, 9));
+	}
+}	// namespace CoTigraphy
@@ -0,0 +1,344 @@
+﻿// \file test_webp_mux_writer.cpp
+// \last_updated 2026-10-16
+// \author Oh Sungsik <ohsungsik@outlook.com>
+// \copyright (C) 2025. Oh Sungsik. All rights reserved.
+
+#include "pch.hpp"
+#include <PixelKernels.hpp>
+#include <WebPMuxWriter.hpp>
+
+#include <webp/demux.h>
+
+namespace CoTigraphy
+{
+	class UnitTest_WebPMuxWriter : public ::testing::Test
+	{
+	protected:
+		// 홀수 크기 (오른쪽/아래쪽 끝의 2×2 블록이 캔버스 밖으로 걸침)
+		static constexpr size_t mWidth = 21;
+		static constexpr size_t mHeight = 11;
+
+		// 손실 인코딩 후 채널별 최대 오차
+		// (색 경계의 2×2 블록은 디코더가 U, V를 보간하므로 30 정도까지 차이남, 다른 위치의 픽셀이 보이면 100 이상)
+		static constexpr int mLossyTolerance = 40;
+
+		static constexpr COLORREF mBackgroundColor = RGB(0xEB, 0xED, 0xF0);
+		static constexpr COLORREF mDarkColor = RGB(0x21, 0x6E, 0x39);
+		static constexpr COLORREF mLightColor = RGB(0x9B, 0xE9, 0xA8);
+
+		/**
+		 * @brief 디코딩한 프레임 하나
+		 */
+		struct DecodedFrame
+		{
+			std::vector<uint32_t> mPixels; // 합성된 캔버스 전체 (ARGB)
+			int mTimestamp = 0; // 프레임이 끝나는 시각 (ms)
+			RECT mRect{}; // ANMF 프레임 영역 (offset, 크기)
+		};
+
+		/**
+		 * @brief 기준 캔버스의 rect를 color로 칠함
+		 */
+		static void FillCanvas(_Inout_ std::vector<COLORREF>& canvas, _In_ const RECT& rect, _In_ const COLORREF color)
+		{
+			for (LONG y = rect.top; y < rect.bottom; ++y)
+				std::fill(canvas.begin() + y * mWidth + rect.left, canvas.begin() + y * mWidth + rect.right, color);
+		}
+
+		/**
+		 * @brief 기준 캔버스를 ARGB로 변환
+		 */
+		static std::vector<uint32_t> ToArgb(_In_ const std::vector<COLORREF>& canvas)
+		{
+			std::vector<uint32_t> argb(canvas.size());
+			std::transform(canvas.begin(), canvas.end(), argb.begin(), PixelKernels::ToPixel);
+			return argb;
+		}
+
+		/**
+		 * @brief 기준 캔버스를 손실 WebPMuxWriter의 입력(YUV420)으로 변환 (캔버스 밖 블록 픽셀은 안쪽 픽셀을 반복)
+		 */
+		static std::vector<uint8_t> ToYuv420(_In_ const std::vector<COLORREF>& canvas)
+		{
+			constexpr size_t chromaWidth = (mWidth + 1) / 2;
+			constexpr size_t chromaHeight = (mHeight + 1) / 2;
+			constexpr size_t chromaSize = chromaWidth * chromaHeight;
+
+			std::vector<uint8_t> buffer(mWidth * mHeight + 2 * chromaSize);
+			std::transform(canvas.begin(), canvas.end(), buffer.begin(), PixelKernels::ToLuma);
+
+			for (size_t blockY = 0; blockY < chromaHeight; ++blockY)
+			{
+				for (size_t blockX = 0; blockX < chromaWidth; ++blockX)
+				{
+					const size_t left = blockX * 2;
+					const size_t top = blockY * 2;
+					const size_t right = std::min(left + 1, mWidth - 1);
+					const size_t bottom = std::min(top + 1, mHeight - 1);
+
+					const ChromaPixel chromaPixel = PixelKernels::ToChroma({
+						canvas[top * mWidth + left], canvas[top * mWidth + right],
+						canvas[bottom * mWidth + left], canvas[bottom * mWidth + right]
+					});
+					buffer[mWidth * mHeight + blockY * chromaWidth + blockX] = chromaPixel.mU;
+					buffer[mWidth * mHeight + chromaSize + blockY * chromaWidth + blockX] = chromaPixel.mV;
+				}
+			}
+			return buffer;
+		}
+
+		/**
+		 * @brief 기준 캔버스를 한 장짜리 정지 이미지(무손실 VP8L)로 인코딩
+		 */
+		static std::vector<uint8_t> EncodeStillImage(_In_ const std::vector<COLORREF>& canvas)
+		{
+			// MODE_BGRA와 마찬가지로 little-endian ARGB uint32는 B, G, R, A 순서의 바이트
+			const std::vector<uint32_t> argb = ToArgb(canvas);
+
+			uint8_t* output = nullptr;
+			const size_t size = WebPEncodeLosslessBGRA(reinterpret_cast<const uint8_t*>(argb.data()), mWidth, mHeight,
+			                                           mWidth * sizeof(uint32_t), &output);
+			std::vector<uint8_t> webpData(output, output + size);
+			WebPFree(output);
+			return webpData;
+		}
+
+		/**
+		 * @brief WebP 애니메이션을 디코딩해 프레임마다 합성된 캔버스, 끝나는 시각, ANMF 영역을 반환
+		 */
+		static std::vector<DecodedFrame> Decode(_In_ const std::vector<uint8_t>& webpData)
+		{
+			std::vector<DecodedFrame> frames;
+			const WebPData data{webpData.data(), webpData.size()};
+
+			// MODE_BGRA는 little-endian ARGB uint32와 같은 바이트 순서
+			WebPAnimDecoderOptions decoderOptions;
+			if (WebPAnimDecoderOptionsInit(&decoderOptions) == 0)
+			{
+				ADD_FAILURE() << "WebPAnimDecoderOptionsInit() failed";
+				return frames;
+			}
+			decoderOptions.color_mode = MODE_BGRA;
+
+			WebPAnimDecoder* const decoder = WebPAnimDecoderNew(&data, &decoderOptions);
+			if (decoder == nullptr)
+			{
+				ADD_FAILURE() << "WebPAnimDecoderNew() failed";
+				return frames;
+			}
+
+			while (WebPAnimDecoderHasMoreFrames(decoder))
+			{
+				uint8_t* pixels = nullptr;
+				DecodedFrame frame;
+				if (WebPAnimDecoderGetNext(decoder, &pixels, &frame.mTimestamp) == 0)
+				{
+					ADD_FAILURE() << "WebPAnimDecoderGetNext() failed";
+					break;
+				}
+
+				const uint32_t* const argb = reinterpret_cast<const uint32_t*>(pixels);
+				frame.mPixels.assign(argb, argb + mWidth * mHeight);
+				frames.push_back(std::move(frame));
+			}
+			WebPAnimDecoderDelete(decoder);
+
+			// 디코더는 합성된 캔버스만 주므로 ANMF 영역은 demux로 읽음
+			WebPDemuxer* const demuxer = WebPDemux(&data);
+			if (demuxer == nullptr)
+			{
+				ADD_FAILURE() << "WebPDemux() failed";
+				return frames;
+			}
+
+			WebPIterator iterator;
+			for (size_t frameIndex = 0; frameIndex < frames.size(); ++frameIndex)
+			{
+				if (WebPDemuxGetFrame(demuxer, static_cast<int>(frameIndex) + 1, &iterator) == 0)
+				{
+					ADD_FAILURE() << "WebPDemuxGetFrame() failed";
+					break;
+				}
+
+				frames[frameIndex].mRect = RECT{
+					iterator.x_offset, iterator.y_offset,
+					iterator.x_offset + iterator.width, iterator.y_offset + iterator.height
+				};
+			}
+			WebPDemuxReleaseIterator(&iterator);
+			WebPDemuxDelete(demuxer);
+
+			return frames;
+		}
+
+		/**
+		 * @brief 두 ARGB 캔버스의 R, G, B 채널별 차이 중 가장 큰 값
+		 */
+		static int GetMaxChannelDifference(_In_ const std::vector<uint32_t>& lhs, _In_ const std::vector<uint32_t>& rhs)
+		{
+			int maxDifference = 0;
+			for (size_t i = 0; i < std::min(lhs.size(), rhs.size()); ++i)
+			{
+				for (const int shift : {0, 8, 16})
+				{
+					const int difference = std::abs(static_cast<int>((lhs[i] >> shift) & 0xFF) -
+					                                static_cast<int>((rhs[i] >> shift) & 0xFF));
+					maxDifference = std::max(maxDifference, difference);
+				}
+			}
+			return maxDifference;
+		}
+	};
+
+	// 손실(YUV420) 프레임은 홀수/캔버스 끝 dirtyRect도 왼쪽/위쪽만 짝수로 내린 영역으로 인코딩되고, 디코딩하면 캔버스와 같아야 함
+	TEST_F(UnitTest_WebPMuxWriter, AddFrame_LossyOddRectsMatchCanvas)
+	{
+		std::vector<COLORREF> canvas(mWidth * mHeight, mBackgroundColor);
+
+		const std::vector<std::pair<RECT, COLORREF>> paints = {
+			{RECT{0, 0, 21, 11}, mBackgroundColor},
+			{RECT{3, 3, 7, 5}, mDarkColor}, // 홀수 왼쪽/위쪽
+			{RECT{17, 8, 21, 11}, mLightColor}, // 캔버스 끝 (홀수 오른쪽/아래쪽)
+			{RECT{9, 1, 10, 10}, mDarkColor}, // 1픽셀 폭
+			{RECT{0, 0, 21, 11}, mLightColor}, // 캔버스 전체
+		};
+		const std::vector<RECT> expectedRects = {
+			RECT{0, 0, 21, 11}, RECT{2, 2, 7, 5}, RECT{16, 8, 21, 11}, RECT{8, 0, 10, 10}, RECT{0, 0, 21, 11}
+		};
+
+		WebPMuxWriter webpMuxWriter;
+		ASSERT_TRUE(webpMuxWriter.Initialize(mWidth, mHeight).IsSucceeded());
+		ASSERT_EQ(webpMuxWriter.GetPixelFormat(), ePixelFormat::YUV420);
+
+		std::vector<std::vector<uint32_t>> expectedFrames;
+		for (const auto& [rect, color] : paints)
+		{
+			FillCanvas(canvas, rect, color);
+			expectedFrames.push_back(ToArgb(canvas));
+			EXPECT_TRUE(webpMuxWriter.AddFrame(ToYuv420(canvas).data(), rect, 80));
+		}
+
+		std::vector<uint8_t> webpData;
+		ASSERT_TRUE(webpMuxWriter.Assemble(webpData).IsSucceeded());
+
+		const std::vector<DecodedFrame> frames = Decode(webpData);
+		ASSERT_EQ(frames.size(), expectedFrames.size());
+		for (size_t frame = 0; frame < frames.size(); ++frame)
+		{
+			SCOPED_TRACE(frame);
+			EXPECT_EQ(frames[frame].mTimestamp, static_cast<int>(frame + 1) * 80);
+			EXPECT_TRUE(EqualRect(&frames[frame].mRect, &expectedRects[frame]));
+			EXPECT_LE(GetMaxChannelDifference(frames[frame].mPixels, expectedFrames[frame]), mLossyTolerance);
+		}
+	}
+
+	// 무손실(ARGB) 프레임은 변경 영역만 인코딩해도 디코딩하면 캔버스와 픽셀 단위로 같아야 함
+	TEST_F(UnitTest_WebPMuxWriter, AddFrame_LosslessIsPixelExact)
+	{
+		std::vector<COLORREF> canvas(mWidth * mHeight, mBackgroundColor);
+
+		EncodeOptions encodeOptions;
+		encodeOptions.mLossless = true;
+
+		WebPMuxWriter webpMuxWriter;
+		webpMuxWriter.SetEncodeOptions(encodeOptions);
+		ASSERT_TRUE(webpMuxWriter.Initialize(mWidth, mHeight).IsSucceeded());
+		ASSERT_EQ(webpMuxWriter.GetPixelFormat(), ePixelFormat::ARGB);
+
+		std::vector<std::vector<uint32_t>> expectedFrames;
+		for (const auto& [rect, color] : {std::pair{RECT{0, 0, 21, 11}, mBackgroundColor},
+		                                  std::pair{RECT{3, 3, 7, 5}, mDarkColor},
+		                                  std::pair{RECT{17, 8, 21, 11}, mLightColor}})
+		{
+			FillCanvas(canvas, rect, color);
+			expectedFrames.push_back(ToArgb(canvas));
+			EXPECT_TRUE(webpMuxWriter.AddFrame(reinterpret_cast<const uint8_t*>(expectedFrames.back().data()), rect, 80));
+		}
+
+		std::vector<uint8_t> webpData;
+		ASSERT_TRUE(webpMuxWriter.Assemble(webpData).IsSucceeded());
+
+		const std::vector<DecodedFrame> frames = Decode(webpData);
+		ASSERT_EQ(frames.size(), expectedFrames.size());
+		for (size_t frame = 0; frame < frames.size(); ++frame)
+			EXPECT_EQ(frames[frame].mPixels, expectedFrames[frame]) << frame;
+	}
+
+	// 대기 중인 프레임이 없을 때(AddAnimation() 직후) 빈 dirtyRect는 프레임 타이밍을 위해 왼쪽 위 2×2만 인코딩
+	TEST_F(UnitTest_WebPMuxWriter, AddFrame_EmptyRectAfterAnimationEncodesTopLeftBlock)
+	{
+		std::vector<COLORREF> canvas(mWidth * mHeight, mBackgroundColor);
+		FillCanvas(canvas, RECT{0, 0, 4, 4}, mDarkColor);
+
+		WebPMuxWriter webpMuxWriter;
+		ASSERT_TRUE(webpMuxWriter.Initialize(mWidth, mHeight).IsSucceeded());
+		ASSERT_TRUE(webpMuxWriter.AddAnimation(EncodeStillImage(canvas), 120));
+		EXPECT_TRUE(webpMuxWriter.AddFrame(ToYuv420(canvas).data(), RECT{}, 80));
+
+		std::vector<uint8_t> webpData;
+		ASSERT_TRUE(webpMuxWriter.Assemble(webpData).IsSucceeded());
+
+		const std::vector<DecodedFrame> frames = Decode(webpData);
+		ASSERT_EQ(frames.size(), 2u);
+		EXPECT_EQ(frames[1].mTimestamp, 200);
+
+		const RECT expectedRect{0, 0, 2, 2};
+		EXPECT_TRUE(EqualRect(&frames[1].mRect, &expectedRect));
+		EXPECT_LE(GetMaxChannelDifference(frames[1].mPixels, ToArgb(canvas)), mLossyTolerance);
+	}
+
+	// 정지 이미지는 offset (0, 0)의 프레임 하나로 붙고 재생 시간은 인자로 받은 값, 캔버스 크기가 다르면 실패
+	TEST_F(UnitTest_WebPMuxWriter, AddAnimation_StillImageBecomesOneFrame)
+	{
+		std::vector<COLORREF> canvas(mWidth * mHeight, mBackgroundColor);
+		FillCanvas(canvas, RECT{3, 3, 7, 5}, mDarkColor);
+		const std::vector<uint8_t> stillImage = EncodeStillImage(canvas);
+
+		WebPMuxWriter webpMuxWriter;
+		ASSERT_TRUE(webpMuxWriter.Initialize(mWidth + 2, mHeight).IsSucceeded());
+		EXPECT_FALSE(webpMuxWriter.AddAnimation(stillImage, 150));
+
+		ASSERT_TRUE(webpMuxWriter.Initialize(mWidth, mHeight).IsSucceeded());
+		ASSERT_TRUE(webpMuxWriter.AddAnimation(stillImage, 150));
+		ASSERT_TRUE(webpMuxWriter.AddAnimation(stillImage, 50));
+
+		std::vector<uint8_t> webpData;
+		ASSERT_TRUE(webpMuxWriter.Assemble(webpData).IsSucceeded());
+
+		const std::vector<DecodedFrame> frames = Decode(webpData);
+		ASSERT_EQ(frames.size(), 2u);
+		EXPECT_EQ(frames[0].mTimestamp, 150);
+		EXPECT_EQ(frames[1].mTimestamp, 200);
+
+		const RECT canvasRect{0, 0, mWidth, mHeight};
+		for (const DecodedFrame& frame : frames)
+		{
+			EXPECT_TRUE(EqualRect(&frame.mRect, &canvasRect));
+			EXPECT_EQ(frame.mPixels, ToArgb(canvas));
+		}
+	}
+
+	// 직전 프레임과 같은 프레임(빈 dirtyRect, 바뀐 픽셀이 없는 dirtyRect)은 인코딩하지 않고 직전 프레임의 재생 시간을 늘림
+	TEST_F(UnitTest_WebPMuxWriter, AddFrame_UnchangedFrameExtendsDuration)
+	{
+		std::vector<COLORREF> canvas(mWidth * mHeight, mBackgroundColor);
+
+		WebPMuxWriter webpMuxWriter;
+		ASSERT_TRUE(webpMuxWriter.Initialize(mWidth, mHeight).IsSucceeded());
+
+		EXPECT_TRUE(webpMuxWriter.AddFrame(ToYuv420(canvas).data(), RECT{0, 0, mWidth, mHeight}, 80));
+		EXPECT_TRUE(webpMuxWriter.AddFrame(ToYuv420(canvas).data(), RECT{}, 40));
+		EXPECT_TRUE(webpMuxWriter.AddFrame(ToYuv420(canvas).data(), RECT{3, 3, 7, 5}, 120));
+		FillCanvas(canvas, RECT{3, 3, 7, 5}, mDarkColor);
+		EXPECT_TRUE(webpMuxWriter.AddFrame(ToYuv420(canvas).data(), RECT{3, 3, 7, 5}, 200));
+
+		std::vector<uint8_t> webpData;
+		ASSERT_TRUE(webpMuxWriter.Assemble(webpData).IsSucceeded());
+
+		const std::vector<DecodedFrame> frames = Decode(webpData);
+		ASSERT_EQ(frames.size(), 2u);
+		EXPECT_EQ(frames[0].mTimestamp, 240);
+		EXPECT_EQ(frames[1].mTimestamp, 440);
+		EXPECT_LE(GetMaxChannelDifference(frames[1].mPixels, ToArgb(canvas)), mLossyTolerance);
+	}
+}	// namespace CoTigraphy
@@ -0,0 +1,111 @@
+﻿// \file test_webp_writer.cpp
+// \last_updated 2026-10-16
+// \author Oh Sungsik <ohsungsik@outlook.com>
+// \copyright (C) 2025. Oh Sungsik. All rights reserved.
+
+#include "pch.hpp"
+#include <PixelKernels.hpp>
+#include <WebPWriter.hpp>
+
+#include <webp/demux.h>
+
+namespace CoTigraphy
+{
+	// 팔레트 캔버스는 VP8L로 인코딩되므로 디코딩한 프레임이 펼친 ARGB와 픽셀 단위로 같아야 함
+	TEST(UnitTest_WebPWriter, AddFrame_PaletteLosslessIsPixelExact)
+	{
+		constexpr size_t width = 26;
+		constexpr size_t height = 10;
+		constexpr size_t pixelCount = width * height;
+		const uint32_t colors[] = {0xFF010409, 0xFFEBEDF0, 0xFF9BE9A8, 0xFF216E39};
+
+		std::vector<uint8_t> buffer(PixelKernels::GetPaletteOffset(pixelCount) + PixelKernels::mPaletteCapacity * 4);
+		uint32_t* const palette = reinterpret_cast<uint32_t*>(buffer.data() + PixelKernels::GetPaletteOffset(pixelCount));
+		std::copy(std::begin(colors), std::end(colors), palette);
+
+		WebPWriter webpWriter;
+		ASSERT_TRUE(webpWriter.Initialize(width, height).IsSucceeded());
+
+		std::vector<std::vector<uint32_t>> expectedFrames;
+		for (size_t frame = 0; frame < 3; ++frame)
+		{
+			for (size_t pixel = 0; pixel < pixelCount; ++pixel)
+				buffer[pixel] = static_cast<uint8_t>((pixel / 3 + frame) % 4);
+
+			std::vector<uint32_t> expected(pixelCount);
+			PixelKernels::ExpandIndexedSpan(expected.data(), buffer.data(), pixelCount, palette);
+			expectedFrames.push_back(std::move(expected));
+
+			EXPECT_TRUE(webpWriter.AddFrame(buffer.data(), RECT{0, 0, width, height}, 80));
+		}
+
+		std::vector<uint8_t> webpData;
+		ASSERT_TRUE(webpWriter.Assemble(webpData).IsSucceeded());
+
+		// MODE_BGRA는 little-endian ARGB uint32와 같은 바이트 순서
+		WebPAnimDecoderOptions decoderOptions;
+		ASSERT_NE(WebPAnimDecoderOptionsInit(&decoderOptions), 0);
+		decoderOptions.color_mode = MODE_BGRA;
+
+		const WebPData data{webpData.data(), webpData.size()};
+		WebPAnimDecoder* const decoder = WebPAnimDecoderNew(&data, &decoderOptions);
+		ASSERT_NE(decoder, nullptr);
+
+		size_t frame = 0;
+		while (WebPAnimDecoderHasMoreFrames(decoder))
+		{
+			uint8_t* pixels = nullptr;
+			int timestamp = 0;
+			ASSERT_NE(WebPAnimDecoderGetNext(decoder, &pixels, &timestamp), 0);
+			ASSERT_LT(frame, expectedFrames.size());
+			EXPECT_EQ(std::memcmp(pixels, expectedFrames[frame].data(), pixelCount * 4), 0) << frame;
+			++frame;
+		}
+		EXPECT_EQ(frame, expectedFrames.size());
+
+		WebPAnimDecoderDelete(decoder);
+	}
+
+	// 직전 프레임과 같은 프레임은 인코딩하지 않고 그 표시 시간만큼 직전 프레임의 재생 시간을 늘림
+	TEST(UnitTest_WebPWriter, AddFrame_DuplicateFrameExtendsDuration)
+	{
+		constexpr size_t width = 8;
+		constexpr size_t height = 4;
+		constexpr size_t pixelCount = width * height;
+
+		std::vector<uint8_t> buffer(PixelKernels::GetPaletteOffset(pixelCount) + PixelKernels::mPaletteCapacity * 4);
+		uint32_t* const palette = reinterpret_cast<uint32_t*>(buffer.data() + PixelKernels::GetPaletteOffset(pixelCount));
+		palette[0] = 0xFF010409;
+		palette[1] = 0xFF9BE9A8;
+
+		WebPWriter webpWriter;
+		ASSERT_TRUE(webpWriter.Initialize(width, height).IsSucceeded());
+
+		// 같은 프레임 3개 (빈 dirtyRect, 바뀐 픽셀이 없는 dirtyRect) 뒤에 바뀐 프레임 1개
+		EXPECT_TRUE(webpWriter.AddFrame(buffer.data(), RECT{0, 0, width, height}, 80));
+		EXPECT_TRUE(webpWriter.AddFrame(buffer.data(), RECT{}, 40));
+		EXPECT_TRUE(webpWriter.AddFrame(buffer.data(), RECT{0, 0, 2, 2}, 120));
+		buffer[0] = 1;
+		EXPECT_TRUE(webpWriter.AddFrame(buffer.data(), RECT{0, 0, 1, 1}, 200));
+
+		std::vector<uint8_t> webpData;
+		ASSERT_TRUE(webpWriter.Assemble(webpData).IsSucceeded());
+
+		const WebPData data{webpData.data(), webpData.size()};
+		WebPAnimDecoder* const decoder = WebPAnimDecoderNew(&data, nullptr);
+		ASSERT_NE(decoder, nullptr);
+
+		// 타임스탬프는 프레임이 끝나는 시각
+		std::vector<int> timestamps;
+		while (WebPAnimDecoderHasMoreFrames(decoder))
+		{
+			uint8_t* pixels = nullptr;
+			int timestamp = 0;
+			ASSERT_NE(WebPAnimDecoderGetNext(decoder, &pixels, &timestamp), 0);
+			timestamps.push_back(timestamp);
+		}
+		WebPAnimDecoderDelete(decoder);
+
+		EXPECT_EQ(timestamps, (std::vector<int>{240, 440}));
+	}
+}	// namespace CoTigraphy